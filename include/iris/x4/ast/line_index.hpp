@@ -0,0 +1,166 @@
+#ifndef IRIS_X4_AST_LINE_INDEX_HPP
+#define IRIS_X4_AST_LINE_INDEX_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace iris::x4::ast {
+
+// The starting offsets of the lines of `[first, last)`, for looking up the
+// line of a position in O(log n) instead of rescanning the input.
+//
+// Line breaks are "\r\n", "\r" and "\n". The index is built on the first
+// query, so it costs nothing if no position is ever looked up; since that
+// mutates the index, concurrent queries need external synchronization until
+// the index has been built once. Offsets are computed in constant time only
+// if `It` is a random access iterator.
+template<std::forward_iterator It>
+class line_index
+{
+public:
+    using iterator_type = It;
+
+    struct line_column
+    {
+        std::size_t line;   // 1-based
+        std::size_t column; // 1-based, after tab expansion
+    };
+
+    line_index(It first, It last)
+        : first_(std::move(first))
+        , last_(std::move(last))
+    {}
+
+    [[nodiscard]] It first() const { return first_; }
+    [[nodiscard]] It last() const { return last_; }
+
+    [[nodiscard]] std::size_t line_count() const
+    {
+        this->build();
+        return starts_.size();
+    }
+
+    // The 1-based line number of `pos`. The "\n" of a "\r\n" belongs to the
+    // line which starts at it, i.e. the one after "\r".
+    [[nodiscard]] std::size_t line_number(It const& pos) const
+    {
+        this->build();
+        std::size_t const offset = this->offset_of(pos);
+        std::size_t line = static_cast<std::size_t>(std::ranges::upper_bound(starts_, offset) - starts_.begin());
+        if (this->is_lf_of_crlf(pos, offset)) ++line;
+        return line;
+    }
+
+    // The position right after the last line break before `pos`
+    [[nodiscard]] It line_start(It const& pos) const
+    {
+        this->build();
+        std::size_t const offset = this->offset_of(pos);
+        if (this->is_lf_of_crlf(pos, offset)) return pos;
+
+        auto const it = std::ranges::upper_bound(starts_, offset);
+        return std::ranges::next(first_, static_cast<std::iter_difference_t<It>>(*std::prev(it)));
+    }
+
+    // Tabs are expanded to `tabs` columns
+    [[nodiscard]] line_column position(It const& pos, int const tabs = 4) const
+    {
+        std::size_t column = 1;
+        for (It it = this->line_start(pos); it != pos; ++it) {
+            column += *it == '\t' ? static_cast<std::size_t>(tabs) : 1;
+        }
+        return line_column{this->line_number(pos), column};
+    }
+
+    // The characters of the 1-based line `n`, without the line break
+    [[nodiscard]] std::ranges::subrange<It> line(std::size_t const n) const
+    {
+        this->build();
+        if (n == 0 || n > starts_.size()) return {last_, last_};
+
+        It start = std::ranges::next(first_, static_cast<std::iter_difference_t<It>>(starts_[n - 1]));
+        It end = start;
+        while (end != last_ && *end != '\r' && *end != '\n') ++end;
+        return {std::move(start), std::move(end)};
+    }
+
+private:
+    [[nodiscard]] std::size_t offset_of(It const& pos) const
+    {
+        return static_cast<std::size_t>(std::ranges::distance(first_, pos));
+    }
+
+    [[nodiscard]] bool is_lf_of_crlf(It const& pos, std::size_t const offset) const
+    {
+        if (offset == 0 || pos == last_ || *pos != '\n') return false;
+
+        if constexpr (std::bidirectional_iterator<It>) {
+            return *std::ranges::prev(pos) == '\r';
+        } else {
+            return *std::ranges::next(first_, static_cast<std::iter_difference_t<It>>(offset - 1)) == '\r';
+        }
+    }
+
+    void build() const
+    {
+        if (built_) return;
+        starts_.push_back(0);
+
+        if constexpr (std::contiguous_iterator<It> && sizeof(std::iter_value_t<It>) == 1) {
+            auto const* const data = reinterpret_cast<char const*>(std::to_address(first_));
+            auto const size = static_cast<std::size_t>(last_ - first_);
+
+            // Without any "\r", the breaks are found by `memchr`, which is
+            // vectorized by the C library
+            if (size != 0 && std::memchr(data, '\r', size) == nullptr) {
+                for (char const* p = data; ; ++p) {
+                    p = static_cast<char const*>(std::memchr(p, '\n', size - static_cast<std::size_t>(p - data)));
+                    if (p == nullptr) break;
+                    starts_.push_back(static_cast<std::size_t>(p - data) + 1);
+                    if (p + 1 == data + size) break;
+                }
+                built_ = true;
+                return;
+            }
+        }
+
+        std::size_t offset = 0;
+        for (It it = first_; it != last_; ++it, ++offset) {
+            auto const c = *it;
+            if (c == '\r') {
+                It next = std::ranges::next(it);
+                if (next != last_ && *next == '\n') {
+                    it = std::move(next);
+                    ++offset;
+                }
+                starts_.push_back(offset + 1);
+
+            } else if (c == '\n') {
+                starts_.push_back(offset + 1);
+            }
+        }
+        built_ = true;
+    }
+
+    It first_;
+    It last_;
+    mutable std::vector<std::size_t> starts_;
+    mutable bool built_ = false;
+};
+
+} // iris::x4::ast
+
+#endif
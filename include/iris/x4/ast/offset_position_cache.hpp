@@ -0,0 +1,172 @@
+#ifndef IRIS_X4_AST_OFFSET_POSITION_CACHE_HPP
+#define IRIS_X4_AST_OFFSET_POSITION_CACHE_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#include <iris/x4/core/attribute.hpp>
+#include <iris/x4/ast/line_index.hpp>
+#include <iris/x4/ast/position_tagged.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <cassert>
+
+namespace iris::x4::ast {
+
+// An alternative to `position_cache` for random access input, which stores
+// each annotated node as a pair of `Offset`s from `first()` instead of a pair
+// of iterators. The offsets are kept in two separate arrays, so a node costs
+// `2 * sizeof(Offset)` bytes, i.e. 8 bytes with the default `Offset`, which
+// can address inputs smaller than 4 GiB; construction throws
+// `std::length_error` for a larger input. Use `std::uint64_t` to lift the
+// limit.
+//
+// It provides the interface of `position_cache` used by error handlers, e.g.
+// `default_error_handler<It, offset_position_cache<It>>`.
+//
+// A node is identified by a single id, stored in both `id_first` and
+// `id_last` of its `position_tagged`; up to 2^31 - 1 nodes can be annotated.
+//
+// For parallel annotation, reserve a block of ids with `allocate(n)` first,
+// then let each thread fill its own ids with `annotate_at(...)`.
+template<std::random_access_iterator It, std::unsigned_integral Offset = std::uint32_t>
+class offset_position_cache
+{
+public:
+    using iterator_type = It;
+    using offset_type = Offset;
+
+    offset_position_cache(iterator_type first, iterator_type last)
+        : first_(first)
+        , last_(last)
+        , lines_(first, last)
+    {
+        if (static_cast<std::make_unsigned_t<std::iter_difference_t<It>>>(last - first) > std::numeric_limits<Offset>::max()) {
+            throw std::length_error("offset_position_cache: the input is too long for the offset type");
+        }
+    }
+
+    template<X4Attribute Attr>
+        requires std::derived_from<Attr, position_tagged>
+    [[nodiscard]] std::ranges::subrange<iterator_type>
+    position_of(Attr const& attr) const
+    {
+        auto const id = static_cast<std::size_t>(attr.id_first);
+        return std::ranges::subrange<iterator_type>{
+            first_ + static_cast<std::iter_difference_t<It>>(firsts_.at(id)),
+            first_ + static_cast<std::iter_difference_t<It>>(lasts_.at(id))
+        };
+    }
+
+    template<X4Attribute Attr>
+        requires (!std::derived_from<Attr, position_tagged>)
+    [[nodiscard]] std::ranges::subrange<iterator_type>
+    position_of(Attr const&) const
+    {
+        // returns an empty position
+        return std::ranges::subrange<iterator_type>{};
+    }
+
+    // This will catch all nodes except those inheriting from position_tagged
+    template<X4Attribute Attr>
+        requires (!std::derived_from<Attr, position_tagged>)
+    static void annotate(Attr&, iterator_type const&, iterator_type const&)
+    {
+        // (no-op) no need for tags
+    }
+
+    template<X4Attribute Attr>
+        requires std::derived_from<Attr, position_tagged>
+    void annotate(Attr& attr, iterator_type first, iterator_type last)
+    {
+        std::size_t const id = this->allocate(1);
+        this->annotate_at(attr, id, first, last);
+    }
+
+    // Appends `n` ids without annotating them, and returns the first one
+    std::size_t allocate(std::size_t const n)
+    {
+        std::size_t const id = firsts_.size();
+        if (n > static_cast<std::size_t>(std::numeric_limits<int>::max()) - id) {
+            throw std::length_error("offset_position_cache: too many nodes");
+        }
+        firsts_.resize(id + n);
+        lasts_.resize(id + n);
+        return id;
+    }
+
+    // Annotates `attr` as the node `id`, which must have been allocated.
+    // Calls for distinct ids may run concurrently.
+    template<X4Attribute Attr>
+        requires std::derived_from<Attr, position_tagged>
+    void annotate_at(Attr& attr, std::size_t const id, iterator_type const& first, iterator_type const& last)
+    {
+        assert(id < firsts_.size());
+        attr.id_first = static_cast<int>(id);
+        attr.id_last = static_cast<int>(id);
+        firsts_[id] = static_cast<Offset>(first - first_);
+        lasts_[id] = static_cast<Offset>(last - first_);
+    }
+
+    void reserve(std::size_t const nodes)
+    {
+        firsts_.reserve(nodes);
+        lasts_.reserve(nodes);
+    }
+
+    // Reserves one node per `elements_per_node` elements of the input
+    void reserve_by_input(std::size_t const elements_per_node)
+    {
+        if (elements_per_node == 0) return;
+        this->reserve(static_cast<std::size_t>(last_ - first_) / elements_per_node);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return firsts_.size();
+    }
+
+    [[nodiscard]] std::vector<Offset> const& first_offsets() const noexcept
+    {
+        return firsts_;
+    }
+
+    [[nodiscard]] std::vector<Offset> const& last_offsets() const noexcept
+    {
+        return lasts_;
+    }
+
+    iterator_type first() const { return first_; }
+    iterator_type last() const { return last_; }
+
+    // Line lookup over `[first(), last())`, built on first use
+    [[nodiscard]] line_index<iterator_type> const&
+    lines() const noexcept
+    {
+        return lines_;
+    }
+
+private:
+    std::vector<Offset> firsts_;
+    std::vector<Offset> lasts_;
+    iterator_type first_;
+    iterator_type last_;
+    line_index<iterator_type> lines_;
+};
+
+} // iris::x4::ast
+
+#endif
@@ -11,6 +11,7 @@
 ==============================================================================*/
 
 #include <iris/x4/core/attribute.hpp>
+#include <iris/x4/ast/line_index.hpp>
 
 #include <concepts>
 #include <ranges>
@@ -37,6 +38,7 @@ public:
     position_cache(iterator_type first, iterator_type last)
         : first_(first)
         , last_(last)
+        , lines_(first, last)
     {}
 
     template<X4Attribute Attr>
@@ -86,10 +88,18 @@ public:
     iterator_type first() const { return first_; }
     iterator_type last() const { return last_; }
 
+    // Line lookup over `[first(), last())`, built on first use
+    [[nodiscard]] line_index<iterator_type> const&
+    lines() const noexcept
+    {
+        return lines_;
+    }
+
 private:
     Container positions_;
     iterator_type first_;
     iterator_type last_;
+    line_index<iterator_type> lines_;
 };
 
 } // ast
@@ -16,5 +16,6 @@
 #include <iris/x4/auxiliary/eol.hpp>
 #include <iris/x4/auxiliary/eoi.hpp>
 #include <iris/x4/auxiliary/attr.hpp>
+#include <iris/x4/auxiliary/cut.hpp>
 
 #endif
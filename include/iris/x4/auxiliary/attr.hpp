@@ -87,11 +87,12 @@ attr_parser(R const&) -> attr_parser<
 template<class T, class HeldValueT>
 struct get_info<attr_parser<T, HeldValueT>>
 {
-    using result_type = std::string;
-    [[nodiscard]] constexpr std::string
-    operator()(attr_parser<T, HeldValueT> const&) const
+    using result_type = std::string_view;
+    static constexpr std::string_view value = "attr";
+    [[nodiscard]] constexpr result_type
+    operator()(attr_parser<T, HeldValueT> const&) const noexcept
     {
-        return "attr";
+        return value;
     }
 };
 
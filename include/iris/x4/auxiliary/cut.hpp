@@ -0,0 +1,119 @@
+#ifndef IRIS_X4_AUXILIARY_CUT_HPP
+#define IRIS_X4_AUXILIARY_CUT_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/parser.hpp>
+#include <iris/x4/core/unused.hpp>
+#include <iris/x4/operator/sequence.hpp>
+#include <iris/x4/directive/expect.hpp>
+
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+namespace iris::x4 {
+
+// `cut` commits the enclosing sequence: in `a >> cut >> b >> c`, once `a` has
+// matched, `b` and `c` are parsed as if written `a > b > c`. A failure past the
+// cut is reported through `x4::set_expectation_failure`, so that enclosing
+// alternatives do not try their remaining branches:
+//
+//     stmt = lit("if") >> cut >> cond >> block
+//          | lit("while") >> cut >> cond >> block
+//          | expr_stmt;
+//
+// An input such as `if (x) oops` then fails with an expectation failure at
+// `oops` instead of being retried as `expr_stmt`. As with `>`, this requires
+// `x4::contexts::expectation_failure` to be bound.
+//
+// `cut` consumes no input and only affects how failures are reported. It
+// commits the sequence it appears in, not the parsers enclosing that sequence:
+// in `omit[lit("if") >> cut >> cond] >> ';' | other`, a missing `;` still
+// backtracks to before `if` and tries `other`. Input before a cut may
+// therefore be re-read, and a streaming input source must not release it on
+// the basis of a cut.
+struct cut_parser : parser<cut_parser>
+{
+    using attribute_type = unused_type;
+
+    static constexpr bool has_attribute = false;
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
+    [[nodiscard]] static constexpr bool
+    parse(It&, Se const&, Context const&, Attr const&) noexcept
+    {
+        return true;
+    }
+};
+
+template<>
+struct get_info<cut_parser>
+{
+    using result_type = std::string_view;
+    static constexpr std::string_view value = "cut";
+    [[nodiscard]] constexpr result_type operator()(cut_parser const&) const noexcept { return value; }
+};
+
+namespace detail {
+
+// Whether everything appended to a sequence is past a cut
+template<class P>
+struct is_committed : std::false_type {};
+
+template<>
+struct is_committed<cut_parser> : std::true_type {};
+
+template<class Left, class Right>
+struct is_committed<sequence<Left, Right>>
+    : std::bool_constant<is_committed<Left>::value || std::is_same_v<Right, cut_parser>>
+{};
+
+template<class P>
+constexpr bool is_committed_v = is_committed<std::remove_cvref_t<P>>::value;
+
+} // detail
+
+// More constrained than the primary `operator>>`; wraps elements appended
+// after a cut in `expect`
+template<X4Subject Left, X4Subject Right>
+    requires detail::is_committed_v<as_parser_plain_t<Left>>
+[[nodiscard]] constexpr sequence<as_parser_plain_t<Left>, expect_directive<as_parser_plain_t<Right>>>
+operator>>(Left&& left, Right&& right)
+    noexcept(
+        is_parser_nothrow_castable_v<Left> &&
+        is_parser_nothrow_castable_v<Right> &&
+        std::is_nothrow_constructible_v<
+            expect_directive<as_parser_plain_t<Right>>,
+            as_parser_t<Right>
+        > &&
+        std::is_nothrow_constructible_v<
+            sequence<as_parser_plain_t<Left>, expect_directive<as_parser_plain_t<Right>>>,
+            as_parser_t<Left>,
+            expect_directive<as_parser_plain_t<Right>>
+        >
+    )
+{
+    return {
+        as_parser(std::forward<Left>(left)),
+        expect_directive<as_parser_plain_t<Right>>(as_parser(std::forward<Right>(right)))
+    };
+}
+
+namespace parsers {
+
+[[maybe_unused]] inline constexpr cut_parser cut{};
+
+} // parsers
+
+using parsers::cut;
+
+} // iris::x4
+
+#endif
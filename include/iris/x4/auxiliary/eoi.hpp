@@ -16,6 +16,7 @@
 #include <iris/x4/core/unused.hpp>
 
 #include <iterator>
+#include <string_view>
 
 namespace iris::x4 {
 
@@ -39,8 +40,9 @@ struct eoi_parser : parser<eoi_parser>
 template<>
 struct get_info<eoi_parser>
 {
-    using result_type = std::string;
-    [[nodiscard]] result_type operator()(eoi_parser const &) const { return "eoi"; }
+    using result_type = std::string_view;
+    static constexpr std::string_view value = "eoi";
+    [[nodiscard]] constexpr result_type operator()(eoi_parser const &) const noexcept { return value; }
 };
 
 namespace parsers {
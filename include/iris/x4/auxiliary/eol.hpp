@@ -16,6 +16,7 @@
 #include <iris/x4/core/unused.hpp>
 
 #include <iterator>
+#include <string_view>
 
 namespace iris::x4 {
 
@@ -51,8 +52,9 @@ struct eol_parser : parser<eol_parser>
 template<>
 struct get_info<eol_parser>
 {
-    using result_type = std::string;
-    [[nodiscard]] result_type operator()(eol_parser const &) const { return "eol"; }
+    using result_type = std::string_view;
+    static constexpr std::string_view value = "eol";
+    [[nodiscard]] constexpr result_type operator()(eol_parser const &) const noexcept { return value; }
 };
 
 namespace parsers {
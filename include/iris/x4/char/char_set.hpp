@@ -17,6 +17,8 @@
 #include <iris/x4/string/case_compare.hpp>
 
 #include <ranges>
+#include <string>
+#include <string_view>
 #include <type_traits>
 
 namespace iris::x4 {
@@ -108,10 +110,11 @@ struct char_set : char_parser<Encoding, char_set<Encoding, Attr>>
 template<class Encoding, X4Attribute Attr>
 struct get_info<char_set<Encoding, Attr>>
 {
-    using result_type = std::string;
-    [[nodiscard]] constexpr std::string operator()(char_set<Encoding, Attr> const& /* p */) const
+    using result_type = std::string_view;
+    static constexpr std::string_view value = "char-set"; // TODO: make more user-friendly
+    [[nodiscard]] constexpr result_type operator()(char_set<Encoding, Attr> const& /* p */) const noexcept
     {
-        return "char-set"; // TODO: make more user-friendly
+        return value;
     }
 };
 
@@ -16,6 +16,7 @@
 #include <iris/x4/core/parser.hpp>
 #include <iris/x4/core/context.hpp>
 #include <iris/x4/core/action_context.hpp>
+#include <iris/x4/core/validation.hpp>
 
 #include <ranges>
 #include <iterator>
@@ -84,27 +85,45 @@ struct action : proxy_parser<Subject, action<Subject, ActionF>>
     {
     }
 
+    // Whether only the subject is parsed, as `x4::validate` does not invoke the action
+    template<class Context>
+    static constexpr bool skips_action = is_validating_v<Context> && !is_required_action_v<ActionF>;
+
     // attr==unused, action wants attribute
     template<std::forward_iterator It, std::sentinel_for<It> Se, class Context>
     [[nodiscard]] constexpr bool
     parse(It& first, Se const& last, Context const& ctx, unused_type) const
         noexcept(
-            std::is_nothrow_default_constructible_v<typename base_type::attribute_type> &&
-            noexcept(this->parse_main(first, last, ctx, std::declval<typename base_type::attribute_type&>()))
+            skips_action<Context>
+                ? noexcept(this->subject.parse(first, last, ctx, unused))
+                : std::is_nothrow_default_constructible_v<typename base_type::attribute_type> &&
+                  noexcept(this->parse_main(first, last, ctx, std::declval<typename base_type::attribute_type&>()))
         )
     {
-        // Synthesize the attribute since one is not supplied
-        typename base_type::attribute_type attribute; // default-initialize
-        return this->parse_main(first, last, ctx, attribute);
+        if constexpr (skips_action<Context>) {
+            return this->subject.parse(first, last, ctx, unused);
+        } else {
+            // Synthesize the attribute since one is not supplied
+            typename base_type::attribute_type attribute; // default-initialize
+            return this->parse_main(first, last, ctx, attribute);
+        }
     }
 
     // Catch-all overload for non-unused_type attribute
     template<std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
     [[nodiscard]] constexpr bool
     parse(It& first, Se const& last, Context const& ctx, Attr& attr) const
-        noexcept(noexcept(this->parse_main(first, last, ctx, attr)))
+        noexcept(
+            skips_action<Context>
+                ? noexcept(this->subject.parse(first, last, ctx, attr))
+                : noexcept(this->parse_main(first, last, ctx, attr))
+        )
     {
-        return this->parse_main(first, last, ctx, attr);
+        if constexpr (skips_action<Context>) {
+            return this->subject.parse(first, last, ctx, attr);
+        } else {
+            return this->parse_main(first, last, ctx, attr);
+        }
     }
 
     constexpr void operator[](auto const&) const = delete; // You can't add semantic action for semantic action
@@ -15,6 +15,7 @@
 #include <iris/x4/traits/container_traits.hpp>
 #include <iris/x4/traits/transform_attribute.hpp>
 
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -154,6 +155,27 @@ struct append_container<container_appender<ContainerAttr>>
     }
 };
 
+template<class ContainerAttr>
+struct reserve_container<container_appender<ContainerAttr>>
+{
+    static constexpr void call(container_appender<ContainerAttr>& appender, std::size_t const n)
+        noexcept(noexcept(traits::reserve(appender.container, n)))
+    {
+        traits::reserve(appender.container, n);
+    }
+};
+
+template<class ContainerAttr>
+    requires HasElementBuffer<ContainerAttr>
+struct container_element_buffer<container_appender<ContainerAttr>>
+{
+    [[nodiscard]] static constexpr container_value_t<ContainerAttr>& call(container_appender<ContainerAttr>& appender)
+        noexcept(noexcept(container_element_buffer<ContainerAttr>::call(appender.container)))
+    {
+        return container_element_buffer<ContainerAttr>::call(appender.container);
+    }
+};
+
 template<class Transformed>
 struct transform_attribute<Transformed, container_appender<Transformed>>
 {
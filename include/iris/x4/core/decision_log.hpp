@@ -0,0 +1,167 @@
+#ifndef IRIS_X4_CORE_DECISION_LOG_HPP
+#define IRIS_X4_CORE_DECISION_LOG_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/context.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace iris::x4 {
+
+namespace contexts {
+
+struct decision_log
+{
+    static constexpr bool is_unique = true;
+};
+
+} // contexts
+
+// The branch taken by an `alternative`
+enum class decision : std::uint8_t
+{
+    left,
+    right,
+    none, // both branches failed
+};
+
+// The outcome of each `alternative` evaluated by a parse, in evaluation
+// order. While recording, decisions made inside a failed branch are dropped,
+// so that the log describes exactly the alternatives which a replay of the
+// same input evaluates. While replaying, each alternative takes the recorded
+// branch without trying the other one.
+//
+// Decisions are packed in 2 bits each.
+class decision_log
+{
+public:
+    enum class mode : std::uint8_t
+    {
+        record,
+        replay,
+    };
+
+    [[nodiscard]] constexpr bool replaying() const noexcept
+    {
+        return mode_ == mode::replay;
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    [[nodiscard]] constexpr decision operator[](std::size_t const i) const noexcept
+    {
+        return static_cast<decision>((bits_[i / per_byte] >> (i % per_byte * 2)) & 0b11u);
+    }
+
+    // Appends `d` and returns its index
+    constexpr std::size_t push(decision const d)
+    {
+        if (size_ % per_byte == 0) bits_.push_back(0);
+        std::size_t const i = size_++;
+        this->set(i, d);
+        return i;
+    }
+
+    constexpr void set(std::size_t const i, decision const d) noexcept
+    {
+        auto& byte = bits_[i / per_byte];
+        auto const shift = static_cast<unsigned>(i % per_byte * 2);
+        byte = static_cast<std::uint8_t>((byte & ~(0b11u << shift)) | (static_cast<unsigned>(d) << shift));
+    }
+
+    // Drops the decisions from index `n` onward
+    constexpr void truncate(std::size_t const n) noexcept
+    {
+        if (n >= size_) return;
+        size_ = n;
+        bits_.resize((n + per_byte - 1) / per_byte);
+    }
+
+    // Switches to replaying from the first decision
+    constexpr void replay() noexcept
+    {
+        mode_ = mode::replay;
+        cursor_ = 0;
+    }
+
+    // The next recorded decision; `decision::none` past the end
+    [[nodiscard]] constexpr decision next() noexcept
+    {
+        if (cursor_ >= size_) return decision::none;
+        return (*this)[cursor_++];
+    }
+
+    constexpr void clear() noexcept
+    {
+        bits_.clear();
+        size_ = 0;
+        cursor_ = 0;
+        mode_ = mode::record;
+    }
+
+private:
+    static constexpr std::size_t per_byte = 4;
+
+    std::vector<std::uint8_t> bits_;
+    std::size_t size_ = 0;
+    std::size_t cursor_ = 0;
+    mode mode_ = mode::record;
+};
+
+namespace detail {
+
+// `parse_left() || parse_right()`, recorded to or replayed from the
+// `x4::decision_log` bound to the context, if any
+template<class Context, class ParseLeft, class ParseRight>
+[[nodiscard]] constexpr bool
+parse_logged_alternative(Context const& ctx, ParseLeft&& parse_left, ParseRight&& parse_right)
+{
+    if constexpr (has_context_v<Context, contexts::decision_log>) {
+        decision_log& log = x4::get<contexts::decision_log>(ctx);
+
+        if (log.replaying()) {
+            switch (log.next()) {
+            case decision::left: return parse_left();
+            case decision::right: return parse_right();
+            case decision::none: return false;
+            }
+            std::unreachable();
+        }
+
+        std::size_t const slot = log.push(decision::none);
+        if (parse_left()) {
+            log.set(slot, decision::left);
+            return true;
+        }
+        log.truncate(slot + 1);
+
+        if (parse_right()) {
+            log.set(slot, decision::right);
+            return true;
+        }
+        log.truncate(slot + 1);
+        return false;
+
+    } else {
+        return parse_left() || parse_right();
+    }
+}
+
+} // detail
+
+} // iris::x4
+
+#endif
@@ -12,6 +12,8 @@
 
 #include <iris/config.hpp>
 
+#include <iris/x4/core/rule_instrumentation.hpp>
+#include <iris/x4/core/decision_log.hpp>
 #include <iris/x4/core/move_to.hpp>
 #include <iris/x4/core/parser_traits.hpp>
 
@@ -210,6 +212,17 @@ parse_alternative(
     return true;
 }
 
+// Whether `parse_alternative(p, ..., attr)` leaves `attr` untouched unless it
+// succeeds, so that `alternative` needs no temporary to roll it back. This is
+// the case when `p` parses into a substitute attribute which is moved into
+// `attr` on success, or when `p` is itself an `alternative`.
+template<class Parser, std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
+constexpr bool is_transactional_alternative_v =
+    !std::is_lvalue_reference_v<typename parse_alternative_pseudo<Parser, It, Se, Context, Attr>::actual_type>;
+
+template<class L, class R, std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
+constexpr bool is_transactional_alternative_v<alternative<L, R>, It, Se, Context, Attr> = !traits::X4Container<Attr>;
+
 template<class Subject>
 struct alternative_helper : proxy_parser<Subject, alternative_helper<Subject>>
 {
@@ -237,8 +250,14 @@ struct parse_into_container_impl<alternative<Left, Right>>
         It& first, Se const& last, Context const& ctx, Attr& attribute
     )
     {
-        return detail::parse_into_container(alternative_helper<Left>{parser.left}, first, last, ctx, attribute)
-            || detail::parse_into_container(alternative_helper<Right>{parser.right}, first, last, ctx, attribute);
+        return detail::parse_logged_alternative(
+            ctx,
+            [&] { return detail::parse_into_container(alternative_helper<Left>{parser.left}, first, last, ctx, attribute); },
+            [&] {
+                detail::note_parse_start(ctx, first);
+                return detail::parse_into_container(alternative_helper<Right>{parser.right}, first, last, ctx, attribute);
+            }
+        );
     }
 
     template<std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
@@ -250,8 +269,14 @@ struct parse_into_container_impl<alternative<Left, Right>>
         Context const& ctx, Attr& attribute
     )
     {
-        return detail::parse_into_container(parser.left, first, last, ctx, attribute)
-            || detail::parse_into_container(parser.right, first, last, ctx, attribute);
+        return detail::parse_logged_alternative(
+            ctx,
+            [&] { return detail::parse_into_container(parser.left, first, last, ctx, attribute); },
+            [&] {
+                detail::note_parse_start(ctx, first);
+                return detail::parse_into_container(parser.right, first, last, ctx, attribute);
+            }
+        );
     }
 };
 
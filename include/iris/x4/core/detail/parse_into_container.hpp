@@ -14,6 +14,8 @@
 
 #include <iris/x4/core/parser.hpp>
 #include <iris/x4/core/container_appender.hpp>
+#include <iris/x4/core/parse_budget.hpp>
+#include <iris/x4/core/rule_instrumentation.hpp>
 
 #include <iris/x4/traits/container_traits.hpp>
 #include <iris/x4/traits/substitution.hpp>
@@ -49,14 +51,29 @@ struct parse_into_container_base_impl
         static_assert(!std::same_as<std::remove_const_t<Attr>, unused_container_type>);
 
         using value_type = traits::container_value_t<unwrap_recursive_type<Attr>>;
-        value_type val; // default-initialize
 
-        //static_assert(Parsable<Parser, It, Se, Context, value_type>);
-        if (!parser.parse(first, last, ctx, val)) return false;
+        if constexpr (traits::HasElementBuffer<unwrap_recursive_type<Attr>>) {
+            // reuse the buffer provided by the container
+            value_type& val = traits::container_element_buffer<unwrap_recursive_type<Attr>>::call(unwrap_recursive(attr));
+            if (!parser.parse(first, last, ctx, val)) return false;
 
-        // push the parsed value into our attribute
-        traits::push_back(unwrap_recursive(attr), std::move(val));
-        return true;
+            [[maybe_unused]] scoped_container_growth<Context, unwrap_recursive_type<Attr>>
+            growth{ctx, unwrap_recursive(attr)};
+            traits::push_back(unwrap_recursive(attr), std::move(val));
+            return detail::charge_budget_attribute(ctx, first, sizeof(value_type));
+
+        } else {
+            value_type val; // default-initialize
+
+            //static_assert(Parsable<Parser, It, Se, Context, value_type>);
+            if (!parser.parse(first, last, ctx, val)) return false;
+
+            // push the parsed value into our attribute
+            [[maybe_unused]] scoped_container_growth<Context, unwrap_recursive_type<Attr>>
+            growth{ctx, unwrap_recursive(attr)};
+            traits::push_back(unwrap_recursive(attr), std::move(val));
+            return detail::charge_budget_attribute(ctx, first, sizeof(value_type));
+        }
     }
 
     // unused_container_type
@@ -13,6 +13,7 @@
 #include <iris/config.hpp>
 
 #include <iris/x4/core/parser_traits.hpp>
+#include <iris/x4/core/rule_instrumentation.hpp>
 #include <iris/x4/core/detail/parse_into_container.hpp>
 
 #include <iris/x4/traits/attribute_category.hpp>
@@ -234,6 +235,7 @@ parse_sequence(Parser const& parser, It& first, Se const& last, Context const& c
         return true;
     }
 
+    detail::note_rollback(ctx, first, local_it);
     return false;
 }
 
@@ -263,6 +265,7 @@ template<
 [[nodiscard]] constexpr bool
 parse_sequence(Parser const& parser, It& first, Se const& last, Context const& ctx, ContainerAttr& container_attr)
     noexcept(
+        !has_context_v<Context, contexts::backtrack_heatmap> &&
         std::is_nothrow_copy_assignable_v<It> &&
         noexcept(detail::parse_sequence_impl(parser.left, first, last, ctx, container_attr)) &&
         noexcept(detail::parse_sequence_impl(parser.right, first, last, ctx, container_attr))
@@ -275,6 +278,7 @@ parse_sequence(Parser const& parser, It& first, Se const& last, Context const& c
         first = std::move(local_it);
         return true;
     }
+    detail::note_rollback(ctx, first, local_it);
     return false;
 }
 
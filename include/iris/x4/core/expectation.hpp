@@ -14,9 +14,13 @@
 
 #include <iris/x4/core/parser.hpp> // for `x4::what`
 #include <iris/x4/core/context.hpp>
+#include <iris/x4/string/utf8.hpp>
 
+#include <concepts>
+#include <cstdint>
 #include <iterator>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
@@ -46,6 +50,7 @@ struct expectation_failure
         noexcept(std::is_nothrow_copy_constructible_v<It> && std::is_nothrow_constructible_v<std::string, WhichT>)
         : where_(where)
         , which_(std::forward<WhichT>(which))
+        , kind_(description_kind::owned)
     {
         if (which_.empty()) {
             which_ = "(unknown location)";
@@ -59,16 +64,23 @@ struct expectation_failure
         return where_;
     }
 
+    // Refers to either the owned description or a static one, see
+    // `emplace_static`.
+    //
+    // Note: this used to return `std::string const&`; construct a
+    // `std::string` from the result to keep a copy.
     [[nodiscard]]
-    constexpr std::string const& which() const noexcept
+    constexpr std::string_view which() const noexcept
     {
         assert(this->has_value());
-        return which_;
+        return kind_ == description_kind::referred ? static_which_ : std::string_view{which_};
     }
 
     constexpr void clear() noexcept
     {
         which_.clear();
+        static_which_ = {};
+        kind_ = description_kind::none;
     }
 
     template<class WhichT>
@@ -78,10 +90,43 @@ struct expectation_failure
     {
         where_ = std::move(where);
         which_ = std::forward<WhichT>(which);
+        static_which_ = {};
+        kind_ = description_kind::owned;
     }
 
-    [[nodiscard]] constexpr explicit operator bool() const noexcept { return !which_.empty(); }
-    [[nodiscard]] constexpr bool has_value() const noexcept { return !which_.empty(); }
+    // Same as `emplace`, but refers to `which` instead of copying it; this
+    // never allocates. `which` must outlive this object, e.g. a string
+    // literal. This is how the descriptions returned from `x4::get_info` as
+    // `std::string_view`, i.e. the static ones and the names of rules, are
+    // recorded.
+    constexpr void emplace_static(It where, std::string_view which)
+        noexcept(std::is_nothrow_move_assignable_v<It>)
+    {
+        where_ = std::move(where);
+        which_.clear();
+        static_which_ = which;
+        kind_ = description_kind::referred;
+    }
+
+    // Same as `emplace`, but the description is `text` in double quotes, as
+    // for a literal string. `text` is copied, reusing the storage of the
+    // previous description; short ones fit in the small string buffer and
+    // are recorded without allocating.
+    constexpr void emplace_quoted(It where, std::string_view text)
+    {
+        where_ = std::move(where);
+        which_.clear();
+        which_.push_back('"');
+        for (char const ch : text) {
+            detail::utf8_put_encode(which_, static_cast<unsigned char>(ch));
+        }
+        which_.push_back('"');
+        static_which_ = {};
+        kind_ = description_kind::owned;
+    }
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return this->has_value(); }
+    [[nodiscard]] constexpr bool has_value() const noexcept { return kind_ != description_kind::none; }
 
     constexpr void swap(expectation_failure& other)
         noexcept(std::is_nothrow_swappable_v<It> && std::is_nothrow_swappable_v<std::string>)
@@ -89,11 +134,22 @@ struct expectation_failure
         using std::swap;
         swap(where_, other.where_);
         swap(which_, other.which_);
+        swap(static_which_, other.static_which_);
+        swap(kind_, other.kind_);
     }
 
 private:
+    enum class description_kind : std::uint8_t
+    {
+        none,
+        owned,    // `which_`
+        referred, // `static_which_`
+    };
+
     It where_{};
     std::string which_;
+    std::string_view static_which_;
+    description_kind kind_ = description_kind::none;
 };
 
 template<std::forward_iterator It>
@@ -129,7 +185,7 @@ constexpr void set_expectation_failure(
     Subject const& subject,
     Context const& ctx
 )
-    noexcept(noexcept(x4::get<contexts::expectation_failure>(ctx).emplace(std::move(where), x4::what(subject))))
+    noexcept(noexcept(get_info<Subject>{}(subject)) && noexcept(x4::get<contexts::expectation_failure>(ctx).emplace(std::move(where), get_info<Subject>{}(subject))))
 {
     static_assert(
         has_context_v<Context, contexts::expectation_failure>,
@@ -137,7 +193,16 @@ constexpr void set_expectation_failure(
         "You probably forgot: `x4::with<x4::contexts::expectation_failure>(failure)[p]`. "
         "Note that you must also bind the context to your skipper."
     );
-    x4::get<contexts::expectation_failure>(ctx).emplace(std::move(where), x4::what(subject));
+    if constexpr (requires { { get_info<Subject>::quoted_text(subject) } -> std::same_as<std::string_view>; }) {
+        x4::get<contexts::expectation_failure>(ctx).emplace_quoted(std::move(where), get_info<Subject>::quoted_text(subject));
+    } else {
+        auto&& info = get_info<Subject>{}(subject);
+        if constexpr (std::is_same_v<std::remove_cvref_t<decltype(info)>, std::string_view>) {
+            x4::get<contexts::expectation_failure>(ctx).emplace_static(std::move(where), info);
+        } else {
+            x4::get<contexts::expectation_failure>(ctx).emplace(std::move(where), std::forward<decltype(info)>(info));
+        }
+    }
 }
 
 template<class Context>
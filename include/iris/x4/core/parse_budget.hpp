@@ -0,0 +1,295 @@
+#ifndef IRIS_X4_CORE_PARSE_BUDGET_HPP
+#define IRIS_X4_CORE_PARSE_BUDGET_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/context.hpp>
+#include <iris/x4/core/expectation.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace iris::x4 {
+
+namespace contexts {
+
+// Bind an `x4::parse_budget` to bound the work of a parse:
+//
+//     x4::parse_budget budget;
+//     budget.set_timeout(std::chrono::milliseconds(50));
+//     budget.set_max_depth(256);
+//
+//     auto const result = parse(input, x4::with<x4::contexts::budget>(budget)[grammar], attr);
+//     if (budget.exhausted()) { /* budget.reason() */ }
+//
+struct budget
+{
+    static constexpr bool is_unique = true;
+};
+
+} // contexts
+
+enum class budget_exhaustion : std::uint8_t
+{
+    none,
+    cancelled,
+    deadline,
+    steps,
+    depth,
+    attribute_memory,
+};
+
+[[nodiscard]] constexpr std::string_view to_string_view(budget_exhaustion const reason) noexcept
+{
+    switch (reason) {
+    case budget_exhaustion::none: return "none";
+    case budget_exhaustion::cancelled: return "cancelled";
+    case budget_exhaustion::deadline: return "deadline";
+    case budget_exhaustion::steps: return "steps";
+    case budget_exhaustion::depth: return "depth";
+    case budget_exhaustion::attribute_memory: return "attribute memory";
+    }
+    return "unknown";
+}
+
+// Limits checked at the head of each iteration of `kleene`, `plus`, `list`,
+// `repeat`, `seek`, `operator_precedence` and of the scan of `seek_any`, on
+// entry to each rule, and on each append to a container attribute. Once any
+// limit is hit, the parse fails: the current and every later check fails,
+// and an expectation failure naming the limit is reported at the current
+// position, so that it is surfaced by `parse_result::expect_failure`.
+//
+//   - steps: the number of checks, i.e. loop iterations and rule entries;
+//   - depth: the number of rules being parsed at once;
+//   - attribute memory: `sizeof` the elements appended to container
+//     attributes, not counting memory owned by the elements themselves;
+//   - deadline and cancellation: looked up once every `check_interval`
+//     steps, as reading the clock costs more than the rest of the check.
+//
+// Every limit is unset by default. A budget is not synchronized, except for
+// the stop token; use one per parse.
+class parse_budget
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    void set_deadline(clock::time_point const deadline) noexcept
+    {
+        deadline_ = deadline;
+    }
+
+    void set_timeout(clock::duration const timeout) noexcept
+    {
+        deadline_ = clock::now() + timeout;
+    }
+
+    void set_stop_token(std::stop_token token) noexcept
+    {
+        stop_token_ = std::move(token);
+    }
+
+    void set_max_steps(std::uint64_t const max_steps) noexcept
+    {
+        max_steps_ = max_steps;
+    }
+
+    void set_max_depth(std::size_t const max_depth) noexcept
+    {
+        max_depth_ = max_depth;
+    }
+
+    void set_max_attribute_bytes(std::size_t const max_bytes) noexcept
+    {
+        max_attribute_bytes_ = max_bytes;
+    }
+
+    void set_check_interval(std::uint32_t const interval) noexcept
+    {
+        check_interval_ = interval == 0 ? 1 : interval;
+        countdown_ = check_interval_;
+    }
+
+    [[nodiscard]] budget_exhaustion reason() const noexcept { return reason_; }
+    [[nodiscard]] bool exhausted() const noexcept { return reason_ != budget_exhaustion::none; }
+
+    [[nodiscard]] std::uint64_t steps() const noexcept { return steps_; }
+    [[nodiscard]] std::size_t depth() const noexcept { return depth_; }
+    [[nodiscard]] std::size_t attribute_bytes() const noexcept { return attribute_bytes_; }
+
+    // Forgets the usage and the exhaustion, keeping the limits
+    void reset() noexcept
+    {
+        reason_ = budget_exhaustion::none;
+        steps_ = 0;
+        depth_ = 0;
+        attribute_bytes_ = 0;
+        countdown_ = check_interval_;
+    }
+
+    // Called by parsers; returns `false` if the budget is exhausted
+    [[nodiscard]] bool step() noexcept
+    {
+        if (reason_ != budget_exhaustion::none) [[unlikely]] return false;
+        if (++steps_ > max_steps_) [[unlikely]] return this->exhaust(budget_exhaustion::steps);
+
+        if (--countdown_ == 0) [[unlikely]] {
+            countdown_ = check_interval_;
+            if (stop_token_.stop_requested()) return this->exhaust(budget_exhaustion::cancelled);
+            if (deadline_ != clock::time_point::max() && clock::now() >= deadline_) {
+                return this->exhaust(budget_exhaustion::deadline);
+            }
+        }
+        return true;
+    }
+
+    // Called by rules on entry; `leave_rule` must be called even on failure
+    [[nodiscard]] bool enter_rule() noexcept
+    {
+        if (++depth_ > max_depth_) [[unlikely]] return this->exhaust(budget_exhaustion::depth);
+        return this->step();
+    }
+
+    // Called by rules on exit
+    void leave_rule() noexcept
+    {
+        --depth_;
+    }
+
+    // Called when an element is appended to a container attribute; returns
+    // `false` if the budget is exhausted
+    [[nodiscard]] bool charge_attribute(std::size_t const bytes) noexcept
+    {
+        if (reason_ != budget_exhaustion::none) [[unlikely]] return false;
+        attribute_bytes_ += bytes;
+        if (attribute_bytes_ > max_attribute_bytes_) [[unlikely]] return this->exhaust(budget_exhaustion::attribute_memory);
+        return true;
+    }
+
+private:
+    bool exhaust(budget_exhaustion const reason) noexcept
+    {
+        if (reason_ == budget_exhaustion::none) reason_ = reason;
+        return false;
+    }
+
+    clock::time_point deadline_ = clock::time_point::max();
+    std::stop_token stop_token_;
+    std::uint64_t max_steps_ = std::numeric_limits<std::uint64_t>::max();
+    std::size_t max_depth_ = std::numeric_limits<std::size_t>::max();
+    std::size_t max_attribute_bytes_ = std::numeric_limits<std::size_t>::max();
+    std::uint32_t check_interval_ = 1024;
+
+    budget_exhaustion reason_ = budget_exhaustion::none;
+    std::uint64_t steps_ = 0;
+    std::size_t depth_ = 0;
+    std::size_t attribute_bytes_ = 0;
+    std::uint32_t countdown_ = 1024;
+};
+
+namespace detail {
+
+template<class Context, std::forward_iterator It>
+constexpr void report_budget_exhaustion(Context const& ctx, It const& where)
+{
+    if constexpr (has_context_v<Context, contexts::expectation_failure>) {
+        auto& failure = x4::get<contexts::expectation_failure>(ctx);
+        if (!failure.has_value()) {
+            failure.emplace(
+                where,
+                std::string("(parse budget exhausted: ") +
+                std::string(x4::to_string_view(x4::get<contexts::budget>(ctx).reason())) + ")"
+            );
+        }
+    }
+}
+
+// `true` unless the bound budget is exhausted, in which case the failure is
+// reported at `first`
+template<class Context, std::forward_iterator It>
+[[nodiscard]] constexpr bool budget_step([[maybe_unused]] Context const& ctx, [[maybe_unused]] It const& first)
+    noexcept(!has_context_v<Context, contexts::budget>)
+{
+    if constexpr (has_context_v<Context, contexts::budget>) {
+        if !consteval {
+            if (!x4::get<contexts::budget>(ctx).step()) [[unlikely]] {
+                detail::report_budget_exhaustion(ctx, first);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// `true` unless charging `bytes` of attribute memory exhausts the bound
+// budget, in which case the failure is reported at `where`
+template<class Context, std::forward_iterator It>
+[[nodiscard]] constexpr bool charge_budget_attribute(
+    [[maybe_unused]] Context const& ctx, [[maybe_unused]] It const& where, [[maybe_unused]] std::size_t const bytes
+) noexcept(!has_context_v<Context, contexts::budget>)
+{
+    if constexpr (has_context_v<Context, contexts::budget>) {
+        if !consteval {
+            if (!x4::get<contexts::budget>(ctx).charge_attribute(bytes)) [[unlikely]] {
+                detail::report_budget_exhaustion(ctx, where);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template<class Context, std::forward_iterator It>
+struct [[nodiscard]] scoped_budget_rule
+{
+    template<class... Args>
+    constexpr explicit scoped_budget_rule(Args&&...) noexcept
+    {}
+
+    [[nodiscard]] static constexpr bool ok() noexcept { return true; }
+};
+
+template<class Context, std::forward_iterator It>
+    requires has_context_v<Context, contexts::budget>
+struct [[nodiscard]] scoped_budget_rule<Context, It>
+{
+    constexpr scoped_budget_rule(Context const& ctx, It const& first)
+        : ctx_(ctx)
+    {
+        if !consteval {
+            ok_ = x4::get<contexts::budget>(ctx_).enter_rule();
+            if (!ok_) [[unlikely]] detail::report_budget_exhaustion(ctx_, first);
+        }
+    }
+
+    constexpr ~scoped_budget_rule()
+    {
+        if !consteval {
+            x4::get<contexts::budget>(ctx_).leave_rule();
+        }
+    }
+
+    [[nodiscard]] constexpr bool ok() const noexcept { return ok_; }
+
+private:
+    Context const& ctx_;
+    bool ok_ = true;
+};
+
+} // detail
+
+} // iris::x4
+
+#endif
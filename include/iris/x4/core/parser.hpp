@@ -17,8 +17,11 @@
 #include <iris/x4/core/unused.hpp>
 #include <iris/x4/core/parser_traits.hpp>
 
+#include <algorithm>
+#include <array>
 #include <iterator>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <concepts>
 #include <utility>
@@ -462,29 +465,68 @@ concept X4Parser = X4ExplicitParser<Parser, It, Se> || X4ImplicitParser<Parser,
 
 
 // The runtime type info that can be obtained via `x4::what(p)`.
+//
+// A specialization may return `std::string_view` instead of `std::string`,
+// in which case the description must refer to storage that outlives any
+// parse, e.g. a string literal. Such descriptions are recorded by
+// expectation failures without being copied. When the description does not
+// depend on the parser object at all, the specialization should also expose
+// it as `static constexpr std::string_view value`, so that the descriptions
+// of enclosing parsers can be built at compile time (see `X4StaticInfo`).
+// Only parsers configured at runtime (e.g. `symbols`) need a `std::string`.
 template<class Subject>
 struct get_info
 {
     static_assert(X4Subject<Subject>);
 
-    [[nodiscard]] static constexpr std::string operator()(Subject const& subject)
+    [[nodiscard]] static constexpr auto operator()(Subject const& subject)
     {
         if constexpr (requires {
             { subject.get_x4_info() } -> std::convertible_to<std::string>;
         }) {
-            return subject.get_x4_info();
+            return std::string(subject.get_x4_info());
 
         } else {
             (void)subject;
     #ifndef IRIS_X4_NO_RTTI
-            return typeid(Subject).name();
+            return std::string_view{typeid(Subject).name()};
     #else
-            return "(get_info undefined)";
+            return std::string_view{"(get_info undefined)"};
     #endif
         }
     }
 };
 
+// Whether the description of `Subject` is a compile-time constant
+template<class Subject>
+concept X4StaticInfo = requires {
+    { get_info<Subject>::value } -> std::same_as<std::string_view const&>;
+};
+
+namespace detail {
+
+// Concatenates compile-time descriptions into static storage. The parts are
+// passed by reference, so each of them must be a named constant, e.g.
+// `get_info<Subject>::value`.
+template<std::string_view const&... Parts>
+struct static_info_join
+{
+private:
+    static constexpr auto storage_ = [] {
+        std::array<char, (Parts.size() + ... + 0)> buf{};
+        auto out = buf.begin();
+        ((out = std::ranges::copy(Parts, out).out), ...);
+        return buf;
+    }();
+
+public:
+    static constexpr std::string_view value{storage_.data(), storage_.size()};
+};
+
+inline constexpr std::string_view info_close_bracket = "]";
+
+} // detail
+
 namespace detail {
 
 // "what" is an extremely common identifier that can be defined in many user-specific
@@ -495,7 +537,7 @@ struct what_fn
     template<X4Subject Subject>
     [[nodiscard]] static constexpr std::string operator()(Subject const& p)
     {
-        return get_info<Subject>{}(p);
+        return std::string(get_info<Subject>{}(p));
     }
 };
 
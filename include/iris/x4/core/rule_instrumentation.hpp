@@ -0,0 +1,369 @@
+#ifndef IRIS_X4_CORE_RULE_INSTRUMENTATION_HPP
+#define IRIS_X4_CORE_RULE_INSTRUMENTATION_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/context.hpp>
+#include <iris/x4/traits/container_traits.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+
+// The hooks through which rules, containers and backtracking parsers report
+// to the debugging tools of `iris/x4/debug`. Each hook is an empty no-op
+// unless its context is bound, and only refers to the bound object through
+// its (dependent) type, so that parsers need not include the tools themselves.
+
+namespace iris::x4 {
+
+namespace contexts {
+
+// Bind an `x4::profiler` to collect per-rule statistics:
+//
+//     x4::profiler prof;
+//     parse(input, x4::with<x4::contexts::profiler>(prof)[grammar], attr);
+//
+struct profiler
+{
+    static constexpr bool is_unique = true;
+};
+
+// Bind an `x4::flight_recorder` to record rule invocations:
+//
+//     thread_local x4::flight_recorder<char const*> recorder(4096);
+//
+//     recorder.set_input(input.data());
+//     auto const result = parse(input, x4::with<x4::contexts::flight_recorder>(recorder)[grammar]);
+//     if (!result) recorder.write_chrome_trace(log);
+//
+struct flight_recorder
+{
+    static constexpr bool is_unique = true;
+};
+
+// Bind an `x4::allocation_counter` to see which rules allocate:
+//
+//     x4::allocation_counter counter;
+//     parse(input, x4::with<x4::contexts::allocation_counter>(counter)[grammar], attr);
+//     counter.dump(std::cerr);
+//
+struct allocation_counter
+{
+    static constexpr bool is_unique = true;
+};
+
+// Bind an `x4::backtrack_heatmap` to see where the input is parsed again and
+// again:
+//
+//     x4::backtrack_heatmap heatmap(input.begin());
+//     parse(input, x4::with<x4::contexts::backtrack_heatmap>(heatmap)[grammar]);
+//     heatmap.dump(std::cerr);
+//
+struct backtrack_heatmap
+{
+    static constexpr bool is_unique = true;
+};
+
+} // contexts
+
+// The state saved by `x4::profiler` on rule entry
+struct profiler_rule_scope
+{
+    std::uint64_t outer_bytes = 0;
+    std::uint64_t start_ticks = 0;
+};
+
+namespace detail {
+
+[[nodiscard]] inline std::size_t next_rule_slot() noexcept
+{
+    static std::atomic<std::size_t> next{0};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+// A small process-wide index identifying `RuleID`, assigned on first use. The
+// debugging tools key their per-rule state on it, without hashing the name.
+template<class RuleID>
+[[nodiscard]] std::size_t rule_slot() noexcept
+{
+    static std::size_t const slot = detail::next_rule_slot();
+    return slot;
+}
+
+template<class RuleID, class Context, std::forward_iterator It>
+struct [[nodiscard]] scoped_rule_profiler
+{
+    template<class... Args>
+    constexpr explicit scoped_rule_profiler(Args&&...) noexcept
+    {}
+};
+
+template<class RuleID, class Context, std::forward_iterator It>
+    requires has_context_v<Context, contexts::profiler>
+struct [[nodiscard]] scoped_rule_profiler<RuleID, Context, It>
+{
+    constexpr scoped_rule_profiler(
+        Context const& ctx,
+        std::string_view rule_name,
+        It const& first,
+        bool const* parse_ok
+    )
+        : ctx_(ctx)
+        , rule_name_(rule_name)
+        , first_(first)
+        , start_(first)
+        , parse_ok_(parse_ok)
+    {
+        if !consteval {
+            scope_ = x4::get<contexts::profiler>(ctx_).enter();
+        }
+    }
+
+    constexpr ~scoped_rule_profiler()
+    {
+        if !consteval {
+            std::uint64_t consumed_bytes = 0;
+            if (*parse_ok_) {
+                consumed_bytes = static_cast<std::uint64_t>(std::ranges::distance(start_, first_)) * sizeof(std::iter_value_t<It>);
+            }
+            x4::get<contexts::profiler>(ctx_).leave(
+                detail::rule_slot<RuleID>(), rule_name_, scope_, *parse_ok_, consumed_bytes
+            );
+        }
+    }
+
+private:
+    Context const& ctx_;
+    std::string_view rule_name_;
+    It const& first_;
+    It start_;
+    bool const* parse_ok_ = nullptr;
+    profiler_rule_scope scope_;
+};
+
+template<class RuleID, class Context, std::forward_iterator It>
+struct [[nodiscard]] scoped_flight_recording
+{
+    template<class... Args>
+    constexpr explicit scoped_flight_recording(Args&&...) noexcept
+    {}
+};
+
+template<class RuleID, class Context, std::forward_iterator It>
+    requires has_context_v<Context, contexts::flight_recorder>
+struct [[nodiscard]] scoped_flight_recording<RuleID, Context, It>
+{
+    constexpr scoped_flight_recording(
+        Context const& ctx,
+        std::string_view rule_name,
+        It const& first,
+        bool const* parse_ok
+    )
+        : ctx_(ctx)
+        , rule_name_(rule_name)
+        , first_(first)
+        , parse_ok_(parse_ok)
+    {
+        if !consteval {
+            x4::get<contexts::flight_recorder>(ctx_).record_enter(detail::rule_slot<RuleID>(), rule_name_, first_);
+        }
+    }
+
+    constexpr ~scoped_flight_recording()
+    {
+        if !consteval {
+            x4::get<contexts::flight_recorder>(ctx_).record_exit(
+                detail::rule_slot<RuleID>(), rule_name_, first_, *parse_ok_
+            );
+        }
+    }
+
+private:
+    Context const& ctx_;
+    std::string_view rule_name_;
+    It const& first_;
+    bool const* parse_ok_ = nullptr;
+};
+
+template<class Container, class Resource>
+[[nodiscard]] constexpr bool allocates_from(Container const& container, Resource const& resource) noexcept
+{
+    if constexpr (requires { container.get_allocator().resource() == &resource; }) {
+        return container.get_allocator().resource() == &resource;
+    } else {
+        (void)container;
+        (void)resource;
+        return false;
+    }
+}
+
+template<class Container>
+concept HasCapacity = requires(Container const& c) {
+    { c.capacity() } -> std::convertible_to<std::size_t>;
+};
+
+template<class Context, class Container>
+struct [[nodiscard]] scoped_container_growth
+{
+    template<class... Args>
+    constexpr explicit scoped_container_growth(Args&&...) noexcept
+    {}
+};
+
+// Records the growth of `container` by the insertions made in its scope
+template<class Context, class Container>
+    requires has_context_v<Context, contexts::allocation_counter>
+struct [[nodiscard]] scoped_container_growth<Context, Container>
+{
+    constexpr scoped_container_growth(Context const& ctx, Container const& container) noexcept
+        : container_(container)
+    {
+        if !consteval {
+            auto& counter = x4::get<contexts::allocation_counter>(ctx);
+            if (!detail::allocates_from(container_, counter)) {
+                counter_ = &counter;
+                before_ = scoped_container_growth::allocated_elements(container_);
+                if constexpr (HasCapacity<Container> && std::default_initializable<Container>) {
+                    inline_capacity_ = static_cast<std::size_t>(Container{}.capacity());
+                }
+            }
+        }
+    }
+
+    constexpr ~scoped_container_growth()
+    {
+        if !consteval {
+            if (counter_ == nullptr) return;
+
+            constexpr std::size_t element_size = sizeof(traits::container_value_t<Container>);
+            std::size_t const after = scoped_container_growth::allocated_elements(container_);
+            if constexpr (HasCapacity<Container>) {
+                counter_->note_growth(before_, after, element_size, inline_capacity_);
+            } else {
+                counter_->note_nodes(after - before_, element_size);
+            }
+        }
+    }
+
+private:
+    [[nodiscard]] static constexpr std::size_t allocated_elements(Container const& container) noexcept
+    {
+        if constexpr (HasCapacity<Container>) {
+            return static_cast<std::size_t>(container.capacity());
+        } else if constexpr (std::ranges::sized_range<Container const>) {
+            return static_cast<std::size_t>(std::ranges::size(container));
+        } else {
+            (void)container;
+            return 0;
+        }
+    }
+
+    Container const& container_;
+    get_context_plain_t<contexts::allocation_counter, Context>* counter_ = nullptr;
+    std::size_t before_ = 0;
+
+    // The capacity of an empty container, nonzero when it stores a few
+    // elements in place (e.g. the small string buffer of `std::string`)
+    std::size_t inline_capacity_ = 0;
+};
+
+template<class Context>
+struct [[nodiscard]] scoped_allocation_rule
+{
+    template<class... Args>
+    constexpr explicit scoped_allocation_rule(Args&&...) noexcept
+    {}
+};
+
+template<class Context>
+    requires has_context_v<Context, contexts::allocation_counter>
+struct [[nodiscard]] scoped_allocation_rule<Context>
+{
+    constexpr scoped_allocation_rule(Context const& ctx, std::string_view rule_name)
+        : ctx_(ctx)
+    {
+        if !consteval {
+            outer_rule_name_ = x4::get<contexts::allocation_counter>(ctx_).enter_rule(rule_name);
+        }
+    }
+
+    constexpr ~scoped_allocation_rule()
+    {
+        if !consteval {
+            x4::get<contexts::allocation_counter>(ctx_).leave_rule(outer_rule_name_);
+        }
+    }
+
+private:
+    Context const& ctx_;
+    std::string_view outer_rule_name_;
+};
+
+template<class Context, std::forward_iterator It>
+constexpr void note_parse_start([[maybe_unused]] Context const& ctx, [[maybe_unused]] It const& it)
+{
+    if constexpr (has_context_v<Context, contexts::backtrack_heatmap>) {
+        if !consteval {
+            x4::get<contexts::backtrack_heatmap>(ctx).note_start(it);
+        }
+    }
+}
+
+template<class Context, std::forward_iterator It>
+constexpr void note_rollback([[maybe_unused]] Context const& ctx, [[maybe_unused]] It const& from, [[maybe_unused]] It const& to)
+{
+    if constexpr (has_context_v<Context, contexts::backtrack_heatmap>) {
+        if !consteval {
+            x4::get<contexts::backtrack_heatmap>(ctx).note_discard(from, to);
+        }
+    }
+}
+
+template<class Context, std::forward_iterator It>
+struct [[nodiscard]] scoped_heatmap_rule
+{
+    template<class... Args>
+    constexpr explicit scoped_heatmap_rule(Args&&...) noexcept
+    {}
+};
+
+template<class Context, std::forward_iterator It>
+    requires has_context_v<Context, contexts::backtrack_heatmap>
+struct [[nodiscard]] scoped_heatmap_rule<Context, It>
+{
+    constexpr scoped_heatmap_rule(Context const& ctx, std::string_view rule_name, It const& first)
+        : ctx_(ctx)
+    {
+        if !consteval {
+            outer_rule_name_ = x4::get<contexts::backtrack_heatmap>(ctx_).enter_rule(rule_name, first);
+        }
+    }
+
+    constexpr ~scoped_heatmap_rule()
+    {
+        if !consteval {
+            x4::get<contexts::backtrack_heatmap>(ctx_).leave_rule(outer_rule_name_);
+        }
+    }
+
+private:
+    Context const& ctx_;
+    std::string_view outer_rule_name_;
+};
+
+} // detail
+
+} // iris::x4
+
+#endif
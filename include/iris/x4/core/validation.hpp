@@ -0,0 +1,103 @@
+#ifndef IRIS_X4_CORE_VALIDATION_HPP
+#define IRIS_X4_CORE_VALIDATION_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/context.hpp>
+
+#include <concepts>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace iris::x4 {
+
+namespace contexts {
+
+// Bound by `x4::validate`. While bound, the parse only recognizes the input:
+// rules construct no attribute and parse their definitions with `unused`
+// (`_val` is `unused` as well), and semantic actions are not invoked unless
+// wrapped in `x4::required`.
+struct validation
+{
+    static constexpr bool is_unique = true;
+};
+
+} // contexts
+
+template<class Context>
+constexpr bool is_validating_v = has_context_v<Context, contexts::validation>;
+
+// A semantic action which is invoked even by `x4::validate`, typically
+// because it rejects some inputs:
+//
+//     int_[x4::required([](auto&& ctx) { return x4::_attr(ctx) < 256; })]
+//
+// The action is invoked with the attribute synthesized as usual.
+template<class F>
+struct required_action
+{
+    static_assert(!std::is_reference_v<F>);
+
+    F f;
+
+    template<class... Args>
+        requires std::invocable<F const&, Args...>
+    constexpr decltype(auto) operator()(Args&&... args) const
+        noexcept(std::is_nothrow_invocable_v<F const&, Args...>)
+    {
+        return std::invoke(f, std::forward<Args>(args)...);
+    }
+};
+
+template<class F>
+constexpr bool is_required_action_v = false;
+
+template<class F>
+constexpr bool is_required_action_v<required_action<F>> = true;
+
+namespace detail {
+
+// Storage for an attribute which is never constructed. While validating, a
+// rule passes a reference to `value` to its definition, which never accesses
+// it.
+template<class T>
+union unconstructed_attribute
+{
+    constexpr unconstructed_attribute() noexcept {}
+    constexpr ~unconstructed_attribute() {}
+
+    unconstructed_attribute(unconstructed_attribute const&) = delete;
+    unconstructed_attribute& operator=(unconstructed_attribute const&) = delete;
+
+    T value;
+};
+
+struct required_fn
+{
+    template<class F>
+    [[nodiscard]] static constexpr required_action<std::remove_cvref_t<F>>
+    operator()(F&& f)
+        noexcept(std::is_nothrow_constructible_v<std::remove_cvref_t<F>, F>)
+    {
+        return {std::forward<F>(f)};
+    }
+};
+
+} // detail
+
+inline namespace cpos {
+
+[[maybe_unused]] inline constexpr detail::required_fn required{};
+
+} // cpos
+
+} // iris::x4
+
+#endif
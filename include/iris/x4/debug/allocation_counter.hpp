@@ -0,0 +1,247 @@
+#ifndef IRIS_X4_DEBUG_ALLOCATION_COUNTER_HPP
+#define IRIS_X4_DEBUG_ALLOCATION_COUNTER_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/rule_instrumentation.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace iris::x4 {
+
+struct allocation_stats
+{
+    std::uint64_t allocations = 0;
+    std::uint64_t deallocations = 0;
+    std::uint64_t bytes = 0;
+
+    // Allocations which replaced the buffer of a growing container, i.e.
+    // moved its elements
+    std::uint64_t reallocations = 0;
+
+    constexpr allocation_stats& operator+=(allocation_stats const& other) noexcept
+    {
+        allocations += other.allocations;
+        deallocations += other.deallocations;
+        bytes += other.bytes;
+        reallocations += other.reallocations;
+        return *this;
+    }
+};
+
+// Counts the memory allocated while it is bound to
+// `x4::contexts::allocation_counter`, in total and per rule. Two sources are
+// seen:
+//   - allocations through the counter itself, a `std::pmr::memory_resource`
+//     forwarding to `upstream()`. Give it to `std::pmr` attributes, or
+//     install it with `allocation_counter::scoped_default` so that the
+//     `std::pmr` containers default-constructed during the parse (e.g. the
+//     temporaries of `alternative` and of container attributes) use it;
+//   - the growth of the containers X4 inserts parsed values into, as seen
+//     through their `capacity()`. Node-based containers are counted as one
+//     allocation per inserted element. Containers allocating from the counter
+//     itself are not counted twice.
+// Other allocations through `std::allocator` are not seen.
+//
+// Allocations are attributed to the innermost rule being parsed, or to the
+// empty rule name outside of any rule. When no counter is bound, parsers
+// compile to exactly the same code as before.
+//
+// Counting is synchronized, as the default resource installed by
+// `scoped_default` may be used by any thread. Allocations made by other
+// threads meanwhile are counted too, and attributed to the rule being parsed;
+// to tell them apart, bind the counter to a single parse at a time and keep
+// other threads from allocating through the default resource.
+class allocation_counter : public std::pmr::memory_resource
+{
+public:
+    struct entry
+    {
+        std::string_view rule_name;
+        allocation_stats stats;
+    };
+
+    // Makes the counter `std::pmr::get_default_resource()` while in scope. As
+    // the default resource is global, this affects all threads; see above.
+    class [[nodiscard]] scoped_default
+    {
+    public:
+        explicit scoped_default(allocation_counter& counter) noexcept
+            : previous_(std::pmr::set_default_resource(&counter))
+        {}
+
+        scoped_default(scoped_default const&) = delete;
+        scoped_default& operator=(scoped_default const&) = delete;
+
+        ~scoped_default()
+        {
+            std::pmr::set_default_resource(previous_);
+        }
+
+    private:
+        std::pmr::memory_resource* previous_;
+    };
+
+    explicit allocation_counter(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept
+        : upstream_(upstream)
+    {}
+
+    allocation_counter(allocation_counter const&) = delete;
+    allocation_counter& operator=(allocation_counter const&) = delete;
+
+    [[nodiscard]] std::pmr::memory_resource* upstream() const noexcept
+    {
+        return upstream_;
+    }
+
+    // Everything counted since construction or the last `clear()`
+    [[nodiscard]] allocation_stats total() const
+    {
+        std::scoped_lock const lock(mutex_);
+        return total_;
+    }
+
+    [[nodiscard]] std::optional<allocation_stats> find(std::string_view const rule_name) const
+    {
+        std::scoped_lock const lock(mutex_);
+        auto const it = by_rule_.find(rule_name);
+        if (it == by_rule_.end()) return std::nullopt;
+        return it->second;
+    }
+
+    // Most bytes first
+    [[nodiscard]] std::vector<entry> rules() const
+    {
+        std::vector<entry> result;
+        {
+            std::scoped_lock const lock(mutex_);
+            result.reserve(by_rule_.size());
+            for (auto const& [name, stats] : by_rule_) {
+                result.push_back(entry{name, stats});
+            }
+        }
+        std::ranges::sort(result, [](entry const& a, entry const& b) {
+            return a.stats.bytes != b.stats.bytes
+                ? a.stats.bytes > b.stats.bytes
+                : a.rule_name < b.rule_name;
+        });
+        return result;
+    }
+
+    void dump(std::ostream& os) const
+    {
+        auto const total = this->total();
+        os << "allocations: " << total.allocations << " (" << total.reallocations << " reallocations), "
+           << total.bytes << " bytes, " << total.deallocations << " deallocations\n";
+        for (auto const& e : this->rules()) {
+            os << "  " << (e.rule_name.empty() ? std::string_view{"(no rule)"} : e.rule_name)
+               << ": " << e.stats.allocations << " (" << e.stats.reallocations << " reallocations), "
+               << e.stats.bytes << " bytes, " << e.stats.deallocations << " deallocations\n";
+        }
+    }
+
+    void clear()
+    {
+        std::scoped_lock const lock(mutex_);
+        by_rule_.clear();
+        total_ = {};
+    }
+
+    // Called by rules on entry. Returns the name to be passed to `leave_rule`.
+    [[nodiscard]] std::string_view enter_rule(std::string_view const rule_name)
+    {
+        std::scoped_lock const lock(mutex_);
+        return std::exchange(current_rule_, rule_name);
+    }
+
+    // Called by rules on exit
+    void leave_rule(std::string_view const outer_rule_name)
+    {
+        std::scoped_lock const lock(mutex_);
+        current_rule_ = outer_rule_name;
+    }
+
+    // Called after inserting into a container whose capacity went from
+    // `old_capacity` to `new_capacity` elements. Up to `inline_capacity`
+    // elements are stored in the container itself (e.g. by the small string
+    // optimization), so that outgrowing them allocates without moving out of
+    // a previous allocation.
+    void note_growth(
+        std::size_t const old_capacity,
+        std::size_t const new_capacity,
+        std::size_t const element_size,
+        std::size_t const inline_capacity = 0
+    )
+    {
+        if (new_capacity <= old_capacity || new_capacity <= inline_capacity) return;
+        bool const moved = old_capacity > inline_capacity;
+        this->record(allocation_stats{
+            .allocations = 1,
+            .deallocations = moved ? 1u : 0u,
+            .bytes = static_cast<std::uint64_t>(new_capacity) * element_size,
+            .reallocations = moved ? 1u : 0u,
+        });
+    }
+
+    // Called after inserting `count` elements into a node-based container
+    void note_nodes(std::size_t const count, std::size_t const element_size)
+    {
+        if (count == 0) return;
+        this->record(allocation_stats{
+            .allocations = count,
+            .bytes = static_cast<std::uint64_t>(count) * element_size,
+        });
+    }
+
+private:
+    void* do_allocate(std::size_t const bytes, std::size_t const alignment) override
+    {
+        void* const p = upstream_->allocate(bytes, alignment);
+        this->record(allocation_stats{.allocations = 1, .bytes = bytes});
+        return p;
+    }
+
+    void do_deallocate(void* const p, std::size_t const bytes, std::size_t const alignment) override
+    {
+        upstream_->deallocate(p, bytes, alignment);
+        this->record(allocation_stats{.deallocations = 1});
+    }
+
+    [[nodiscard]] bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    void record(allocation_stats const& stats)
+    {
+        std::scoped_lock const lock(mutex_);
+        total_ += stats;
+        by_rule_[current_rule_] += stats;
+    }
+
+    std::pmr::memory_resource* upstream_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string_view, allocation_stats> by_rule_;
+    std::string_view current_rule_;
+    allocation_stats total_;
+};
+
+} // iris::x4
+
+#endif
@@ -0,0 +1,198 @@
+#ifndef IRIS_X4_DEBUG_BACKTRACK_HEATMAP_HPP
+#define IRIS_X4_DEBUG_BACKTRACK_HEATMAP_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/rule_instrumentation.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ostream>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace iris::x4 {
+
+// Per input offset, records
+//   - `starts`: the number of parse attempts starting there, counting rule
+//     invocations, retries of an `alternative` with its right branch and
+//     each position tried by `seek`;
+//   - `discarded_bytes`: the input matched from there and then given back,
+//     by a `sequence` whose later element failed, or by a `list` whose
+//     trailing separator was not followed by an element.
+//
+// Discarded input is also attributed to the innermost rule being parsed.
+// Offsets are measured from the iterator given on construction, in linear
+// time unless `It` is a random access iterator.
+template<std::forward_iterator It>
+class backtrack_heatmap
+{
+public:
+    struct cell
+    {
+        std::uint64_t starts = 0;
+        std::uint64_t discarded_bytes = 0;
+    };
+
+    struct rule_entry
+    {
+        std::string_view rule_name;
+        std::uint64_t discarded_bytes = 0;
+    };
+
+    explicit backtrack_heatmap(It base)
+        : base_(std::move(base))
+    {}
+
+    // Indexed by offset; trailing offsets without any record are omitted
+    [[nodiscard]] std::vector<cell> const& cells() const noexcept
+    {
+        return cells_;
+    }
+
+    [[nodiscard]] std::uint64_t total_starts() const noexcept
+    {
+        return total_.starts;
+    }
+
+    [[nodiscard]] std::uint64_t total_discarded_bytes() const noexcept
+    {
+        return total_.discarded_bytes;
+    }
+
+    // Up to `n` rules, most discarded bytes first. Input discarded outside of
+    // any rule is attributed to the empty rule name.
+    [[nodiscard]] std::vector<rule_entry> top_rules(std::size_t const n) const
+    {
+        std::vector<rule_entry> result;
+        result.reserve(by_rule_.size());
+        for (auto const& [name, bytes] : by_rule_) {
+            result.push_back(rule_entry{name, bytes});
+        }
+        std::ranges::sort(result, [](rule_entry const& a, rule_entry const& b) {
+            return a.discarded_bytes != b.discarded_bytes
+                ? a.discarded_bytes > b.discarded_bytes
+                : a.rule_name < b.rule_name;
+        });
+        if (result.size() > n) result.resize(n);
+        return result;
+    }
+
+    // Prints a histogram of `buckets` equal ranges of offsets, followed by the
+    // `top_n` offsets and rules with the most discarded bytes
+    void dump(std::ostream& os, std::size_t const top_n = 5, std::size_t const buckets = 16) const
+    {
+        os << "backtrack heatmap: " << total_.starts << " starts, "
+           << total_.discarded_bytes << " bytes discarded\n";
+        if (cells_.empty() || buckets == 0) return;
+
+        std::size_t const width = (cells_.size() + buckets - 1) / buckets;
+        std::vector<cell> histogram((cells_.size() + width - 1) / width);
+        for (std::size_t i = 0; i < cells_.size(); ++i) {
+            histogram[i / width].starts += cells_[i].starts;
+            histogram[i / width].discarded_bytes += cells_[i].discarded_bytes;
+        }
+
+        std::uint64_t max_discarded = 0;
+        for (auto const& c : histogram) max_discarded = std::max(max_discarded, c.discarded_bytes);
+
+        constexpr std::uint64_t bar_width = 32;
+        for (std::size_t i = 0; i < histogram.size(); ++i) {
+            auto const& c = histogram[i];
+            os << "  [" << i * width << ", " << std::min((i + 1) * width, cells_.size()) << ") "
+               << c.starts << " starts, " << c.discarded_bytes << " bytes ";
+            std::uint64_t const bar = max_discarded == 0 ? 0 : (c.discarded_bytes * bar_width + max_discarded - 1) / max_discarded;
+            for (std::uint64_t j = 0; j < bar; ++j) os << '#';
+            os << '\n';
+        }
+
+        std::vector<std::size_t> offsets;
+        for (std::size_t i = 0; i < cells_.size(); ++i) {
+            if (cells_[i].discarded_bytes != 0) offsets.push_back(i);
+        }
+        std::ranges::stable_sort(offsets, [this](std::size_t a, std::size_t b) {
+            return cells_[a].discarded_bytes > cells_[b].discarded_bytes;
+        });
+        if (offsets.size() > top_n) offsets.resize(top_n);
+
+        os << "top offsets:\n";
+        for (std::size_t const offset : offsets) {
+            os << "  " << offset << ": " << cells_[offset].starts << " starts, "
+               << cells_[offset].discarded_bytes << " bytes\n";
+        }
+
+        os << "top rules:\n";
+        for (auto const& e : this->top_rules(top_n)) {
+            os << "  " << (e.rule_name.empty() ? std::string_view{"(no rule)"} : e.rule_name)
+               << ": " << e.discarded_bytes << " bytes\n";
+        }
+    }
+
+    void clear() noexcept
+    {
+        cells_.clear();
+        by_rule_.clear();
+        total_ = {};
+    }
+
+    // Called by parsers when an attempt starts at `it`
+    void note_start(It const& it)
+    {
+        ++this->cell_at(it).starts;
+        ++total_.starts;
+    }
+
+    // Called by parsers when the input `[from, to)` is given back
+    void note_discard(It const& from, It const& to)
+    {
+        auto const bytes = static_cast<std::uint64_t>(std::ranges::distance(from, to)) * sizeof(std::iter_value_t<It>);
+        if (bytes == 0) return;
+        this->cell_at(from).discarded_bytes += bytes;
+        total_.discarded_bytes += bytes;
+        by_rule_[current_rule_] += bytes;
+    }
+
+    // Called by rules on entry. Returns the name to be passed to `leave_rule`.
+    [[nodiscard]] std::string_view enter_rule(std::string_view const rule_name, It const& it)
+    {
+        this->note_start(it);
+        return std::exchange(current_rule_, rule_name);
+    }
+
+    // Called by rules on exit
+    void leave_rule(std::string_view const outer_rule_name) noexcept
+    {
+        current_rule_ = outer_rule_name;
+    }
+
+private:
+    [[nodiscard]] cell& cell_at(It const& it)
+    {
+        auto const offset = static_cast<std::size_t>(std::ranges::distance(base_, it));
+        if (offset >= cells_.size()) cells_.resize(offset + 1);
+        return cells_[offset];
+    }
+
+    It base_;
+    std::vector<cell> cells_;
+    std::unordered_map<std::string_view, std::uint64_t> by_rule_;
+    std::string_view current_rule_;
+    cell total_;
+};
+
+template<std::forward_iterator It>
+backtrack_heatmap(It) -> backtrack_heatmap<It>;
+
+} // iris::x4
+
+#endif
@@ -24,10 +24,14 @@
 #include <string>
 #include <string_view>
 #include <iterator>
+#include <vector>
 
 namespace iris::x4 {
 
-template<std::forward_iterator It>
+// Reports errors with the line they occur on. The positions of annotated
+// nodes are kept in a `PositionCache`, e.g. `ast::offset_position_cache<It>`
+// for a more compact cache over random access input.
+template<std::forward_iterator It, class PositionCache = ast::position_cache<std::vector<It>>>
 class default_error_handler
 {
     static constexpr int IndentSpaces = 2;
@@ -35,6 +39,7 @@ class default_error_handler
 
 public:
     using iterator_type = It;
+    using position_cache_type = PositionCache;
 
     default_error_handler(
         It first, It last,
@@ -57,7 +62,7 @@ public:
     template<std::sentinel_for<It> Se, class Context>
     void on_expectation_failure(It const&, Se const&, Context const& /*ctx*/, expectation_failure<It> const& failure)
     {
-        (*this)(failure.where(), "Error! Expecting: " + failure.which() + " here:");
+        (*this)(failure.where(), std::string("Error! Expecting: ").append(failure.which()).append(" here:"));
     }
 
     template<class Context, X4Attribute Attr>
@@ -117,7 +122,7 @@ private:
         return pos_cache_.position_of(pos);
     }
 
-    [[nodiscard]] ast::position_cache<std::vector<It>> const&
+    [[nodiscard]] PositionCache const&
     get_position_cache() const noexcept
     {
         return pos_cache_;
@@ -155,13 +160,13 @@ private:
     std::ostream& err_out_;
     std::string file_;
     int tabs_;
-    ast::position_cache<std::vector<It>> pos_cache_;
+    PositionCache pos_cache_;
 
     int trace_indent_ = 0;
 };
 
-template<std::forward_iterator It>
-void default_error_handler<It>::print_file_line(std::size_t line) const
+template<std::forward_iterator It, class PositionCache>
+void default_error_handler<It, PositionCache>::print_file_line(std::size_t line) const
 {
     if (file_ != "") {
         err_out_ << "In file " << file_ << ", ";
@@ -172,8 +177,8 @@ void default_error_handler<It>::print_file_line(std::size_t line) const
     err_out_ << "line " << line << ':' << '\n';
 }
 
-template<std::forward_iterator It>
-void default_error_handler<It>::print_line(It start, It last) const
+template<std::forward_iterator It, class PositionCache>
+void default_error_handler<It, PositionCache>::print_line(It start, It last) const
 {
     auto end = start;
     while (end != last) {
@@ -186,8 +191,8 @@ void default_error_handler<It>::print_line(It start, It last) const
     err_out_ << x4::to_utf8(line) << '\n';
 }
 
-template<std::forward_iterator It>
-void default_error_handler<It>::print_indicator(It& start, It last, char ind) const
+template<std::forward_iterator It, class PositionCache>
+void default_error_handler<It, PositionCache>::print_indicator(It& start, It last, char ind) const
 {
     for (; start != last; ++start) {
         auto c = *start;
@@ -202,9 +207,13 @@ void default_error_handler<It>::print_indicator(It& start, It last, char ind) co
     }
 }
 
-template<std::forward_iterator It>
-It default_error_handler<It>::get_line_start(It first, It pos) const
+template<std::forward_iterator It, class PositionCache>
+It default_error_handler<It, PositionCache>::get_line_start(It first, It pos) const
 {
+    if (first == pos_cache_.first()) {
+        return pos_cache_.lines().line_start(pos);
+    }
+
     It latest = first;
     for (It i = first; i != pos;) {
         if (*i == '\r' || *i == '\n') {
@@ -216,32 +225,14 @@ It default_error_handler<It>::get_line_start(It first, It pos) const
     return latest;
 }
 
-template<std::forward_iterator It>
-std::size_t default_error_handler<It>::position(It i) const
+template<std::forward_iterator It, class PositionCache>
+std::size_t default_error_handler<It, PositionCache>::position(It i) const
 {
-    std::size_t line {1};
-    typename std::iterator_traits<It>::value_type prev {0};
-
-    for (It pos = pos_cache_.first(); pos != i; ++pos) {
-        auto c = *pos;
-        switch (c) {
-        case '\n':
-            if (prev != '\r') ++line;
-            break;
-        case '\r':
-            ++line;
-            break;
-        default:
-            break;
-        }
-        prev = c;
-    }
-
-    return line;
+    return pos_cache_.lines().line_number(i);
 }
 
-template<std::forward_iterator It>
-void default_error_handler<It>::operator()(It err_pos, std::string const& error_message) const
+template<std::forward_iterator It, class PositionCache>
+void default_error_handler<It, PositionCache>::operator()(It err_pos, std::string const& error_message) const
 {
     It first = pos_cache_.first();
     It last = pos_cache_.last();
@@ -255,8 +246,8 @@ void default_error_handler<It>::operator()(It err_pos, std::string const& error_
     err_out_ << "^_" << '\n';
 }
 
-template<std::forward_iterator It>
-void default_error_handler<It>::operator()(It err_first, It err_last, std::string const& error_message) const
+template<std::forward_iterator It, class PositionCache>
+void default_error_handler<It, PositionCache>::operator()(It err_first, It err_last, std::string const& error_message) const
 {
     It first = pos_cache_.first();
     It last = pos_cache_.last();
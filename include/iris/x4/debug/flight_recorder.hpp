@@ -0,0 +1,220 @@
+#ifndef IRIS_X4_DEBUG_FLIGHT_RECORDER_HPP
+#define IRIS_X4_DEBUG_FLIGHT_RECORDER_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/rule_instrumentation.hpp>
+#include <iris/x4/debug/profiler.hpp>
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace iris::x4 {
+
+enum class flight_event_kind : std::uint8_t
+{
+    enter,
+    succeed,
+    fail,
+};
+
+struct flight_event
+{
+    std::uint64_t ticks;   // `x4::profiler_clock`
+    std::uint32_t offset;  // from the input given to `set_input`, truncated to 32 bits
+    std::uint16_t rule;    // index into `flight_recorder::rule_names()`, or `flight_recorder::other_rules`
+    flight_event_kind kind;
+};
+
+static_assert(sizeof(flight_event) == 16);
+
+namespace detail {
+
+// Writes `ticks` in microseconds with a fixed nanosecond precision. The
+// default stream formatting keeps 6 significant digits, which rounds every
+// timestamp past one second and switches to an exponent beyond that.
+inline void write_trace_timestamp(std::ostream& os, std::uint64_t const ticks, double const ticks_per_microsecond)
+{
+    double const us = static_cast<double>(ticks) / ticks_per_microsecond;
+    char buf[64];
+    auto result = std::to_chars(buf, buf + sizeof(buf), us, std::chars_format::fixed, 3);
+    if (result.ec != std::errc{}) {
+        result = std::to_chars(buf, buf + sizeof(buf), us);
+    }
+    os.write(buf, result.ptr - buf);
+}
+
+} // detail
+
+// Records the entry and exit of every rule invoked while bound to
+// `x4::contexts::flight_recorder`, into a ring buffer of fixed capacity
+// which keeps the most recent events. Recording an event does not allocate,
+// except the first time each rule is seen.
+//
+// A recorder is not synchronized; keep one per thread.
+template<std::forward_iterator It>
+class flight_recorder
+{
+public:
+    // The rule index of the events of every rule beyond the first 65535
+    // distinct rule names
+    static constexpr std::uint16_t other_rules = std::numeric_limits<std::uint16_t>::max();
+
+    explicit flight_recorder(std::size_t const capacity)
+        : events_(capacity == 0 ? 1 : capacity)
+    {}
+
+    // Sets the origin of the offsets; call before each parse. Offsets are
+    // measured in linear time unless `It` is a random access iterator.
+    void set_input(It base)
+    {
+        base_ = std::move(base);
+        has_base_ = true;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return events_.size();
+    }
+
+    // The number of events currently held
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return recorded_ < events_.size() ? static_cast<std::size_t>(recorded_) : events_.size();
+    }
+
+    // The number of events overwritten since the last `clear()`
+    [[nodiscard]] std::uint64_t dropped() const noexcept
+    {
+        return recorded_ - this->size();
+    }
+
+    // The held events, oldest first
+    [[nodiscard]] std::vector<flight_event> events() const
+    {
+        std::vector<flight_event> result;
+        result.reserve(this->size());
+        std::size_t const first = recorded_ < events_.size() ? 0 : static_cast<std::size_t>(recorded_ % events_.size());
+        for (std::size_t i = 0; i < this->size(); ++i) {
+            result.push_back(events_[(first + i) % events_.size()]);
+        }
+        return result;
+    }
+
+    [[nodiscard]] std::vector<std::string_view> const& rule_names() const noexcept
+    {
+        return interner_.names();
+    }
+
+    // Forgets the events; the rule names are kept
+    void clear() noexcept
+    {
+        recorded_ = 0;
+    }
+
+    // Writes the held events in the Chrome trace event format, which can be
+    // loaded by `chrome://tracing` and Perfetto. Exits whose entry has been
+    // overwritten are skipped. `ticks_per_microsecond` converts the
+    // timestamps; the default shows ticks as microseconds.
+    void write_chrome_trace(std::ostream& os, double const ticks_per_microsecond = 1.0) const
+    {
+        auto const events = this->events();
+        std::uint64_t const origin = events.empty() ? 0 : events.front().ticks;
+
+        os << "{\"traceEvents\":[";
+        bool first_event = true;
+        std::size_t depth = 0;
+        for (auto const& e : events) {
+            if (e.kind == flight_event_kind::enter) {
+                ++depth;
+            } else {
+                if (depth == 0) continue;
+                --depth;
+            }
+
+            if (!first_event) os << ',';
+            first_event = false;
+
+            os << "\n{\"name\":\"";
+            flight_recorder::write_json_string(
+                os, e.rule == other_rules ? std::string_view{"(other rules)"} : interner_.names()[e.rule]
+            );
+            os << "\",\"ph\":\"" << (e.kind == flight_event_kind::enter ? 'B' : 'E')
+               << "\",\"ts\":";
+            detail::write_trace_timestamp(os, e.ticks - origin, ticks_per_microsecond);
+            os << ",\"pid\":0,\"tid\":0,\"args\":{\"offset\":" << e.offset;
+            if (e.kind != flight_event_kind::enter) {
+                os << ",\"ok\":" << (e.kind == flight_event_kind::succeed ? "true" : "false");
+            }
+            os << "}}";
+        }
+        os << "\n]}\n";
+    }
+
+    // Called by rules on entry
+    void record_enter(std::size_t const rule_slot, std::string_view const rule_name, It const& it)
+    {
+        this->record(this->rule_index(rule_slot, rule_name), it, flight_event_kind::enter);
+    }
+
+    // Called by rules on exit
+    void record_exit(std::size_t const rule_slot, std::string_view const rule_name, It const& it, bool const ok)
+    {
+        this->record(this->rule_index(rule_slot, rule_name), it, ok ? flight_event_kind::succeed : flight_event_kind::fail);
+    }
+
+private:
+    void record(std::uint16_t const rule, It const& it, flight_event_kind const kind)
+    {
+        events_[static_cast<std::size_t>(recorded_ % events_.size())] = flight_event{
+            .ticks = profiler_clock::now(),
+            .offset = has_base_ ? static_cast<std::uint32_t>(std::ranges::distance(base_, it)) : 0,
+            .rule = rule,
+            .kind = kind,
+        };
+        ++recorded_;
+    }
+
+    [[nodiscard]] std::uint16_t rule_index(std::size_t const rule_slot, std::string_view const rule_name)
+    {
+        std::size_t const i = interner_.index(rule_slot, rule_name);
+        return i < other_rules ? static_cast<std::uint16_t>(i) : other_rules;
+    }
+
+    static void write_json_string(std::ostream& os, std::string_view const str)
+    {
+        for (char const c : str) {
+            if (c == '"' || c == '\\') {
+                os << '\\' << c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                os << ' ';
+            } else {
+                os << c;
+            }
+        }
+    }
+
+    std::vector<flight_event> events_;
+    std::uint64_t recorded_ = 0;
+    detail::rule_interner interner_;
+    It base_{};
+    bool has_base_ = false;
+};
+
+} // iris::x4
+
+#endif
@@ -0,0 +1,228 @@
+#ifndef IRIS_X4_DEBUG_PROFILER_HPP
+#define IRIS_X4_DEBUG_PROFILER_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/rule_instrumentation.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+# include <intrin.h>
+# define IRIS_X4_PROFILER_HAS_RDTSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+# include <x86intrin.h>
+# define IRIS_X4_PROFILER_HAS_RDTSC 1
+#else
+# define IRIS_X4_PROFILER_HAS_RDTSC 0
+#endif
+
+namespace iris::x4 {
+
+// The clock used by `x4::profiler`: the time stamp counter where available,
+// `std::chrono::steady_clock` otherwise. Ticks are not converted to time
+struct profiler_clock
+{
+    [[nodiscard]] static std::uint64_t now() noexcept
+    {
+#if IRIS_X4_PROFILER_HAS_RDTSC
+        return static_cast<std::uint64_t>(__rdtsc());
+#else
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+};
+
+// Statistics of the invocations of a single rule. `ticks` includes the time
+// spent in nested rules, and in recursive invocations of the same rule.
+struct rule_profile
+{
+    std::uint64_t calls = 0;
+    std::uint64_t successes = 0;
+    std::uint64_t failures = 0;
+
+    // Input consumed by successful invocations
+    std::uint64_t consumed_bytes = 0;
+
+    // Input which was consumed by nested rules, then given back because the
+    // invocation failed. This is a lower bound of the work wasted by
+    // backtracking, as input matched by parsers other than rules is not
+    // seen by the profiler.
+    std::uint64_t backtracked_bytes = 0;
+
+    std::uint64_t ticks = 0;
+
+    constexpr rule_profile& operator+=(rule_profile const& other) noexcept
+    {
+        calls += other.calls;
+        successes += other.successes;
+        failures += other.failures;
+        consumed_bytes += other.consumed_bytes;
+        backtracked_bytes += other.backtracked_bytes;
+        ticks += other.ticks;
+        return *this;
+    }
+};
+
+namespace detail {
+
+// Assigns dense indices to rule names, in order of first appearance. A rule
+// is looked up in constant time by its `detail::rule_slot`; the name is only
+// compared the first time a slot is seen, so that distinct rules sharing a
+// name share an index.
+class rule_interner
+{
+public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    [[nodiscard]] std::size_t index(std::size_t const slot, std::string_view const rule_name)
+    {
+        if (slot < by_slot_.size() && by_slot_[slot] != npos) return by_slot_[slot];
+
+        std::size_t const i = this->index(rule_name);
+        if (slot >= by_slot_.size()) by_slot_.resize(slot + 1, npos);
+        by_slot_[slot] = i;
+        return i;
+    }
+
+    [[nodiscard]] std::size_t index(std::string_view const rule_name)
+    {
+        if (std::size_t const i = this->find(rule_name); i != npos) return i;
+        names_.push_back(rule_name);
+        return names_.size() - 1;
+    }
+
+    [[nodiscard]] std::size_t find(std::string_view const rule_name) const noexcept
+    {
+        auto const it = std::ranges::find(names_, rule_name);
+        return it == names_.end() ? npos : static_cast<std::size_t>(it - names_.begin());
+    }
+
+    [[nodiscard]] std::vector<std::string_view> const& names() const noexcept
+    {
+        return names_;
+    }
+
+    void clear() noexcept
+    {
+        names_.clear();
+        by_slot_.clear();
+    }
+
+private:
+    std::vector<std::string_view> names_;
+    std::vector<std::size_t> by_slot_;
+};
+
+} // detail
+
+// Per-rule statistics, aggregated by rule name, of every `rule` invocation
+// made while it is bound to `x4::contexts::profiler`. When no profiler is
+// bound, rules compile to exactly the same code as before.
+//
+// A profiler is not synchronized; bind a separate one on each thread and
+// `merge` them afterwards.
+class profiler
+{
+public:
+    struct entry
+    {
+        std::string_view rule_name;
+        rule_profile profile;
+    };
+
+    [[nodiscard]] rule_profile& operator[](std::string_view const rule_name)
+    {
+        return this->profile_at(interner_.index(rule_name));
+    }
+
+    [[nodiscard]] rule_profile const* find(std::string_view const rule_name) const noexcept
+    {
+        std::size_t const i = interner_.find(rule_name);
+        return i == detail::rule_interner::npos ? nullptr : &entries_[i].profile;
+    }
+
+    // In order of the first completed invocation
+    [[nodiscard]] std::vector<entry> const& entries() const noexcept
+    {
+        return entries_;
+    }
+
+    void merge(profiler const& other)
+    {
+        for (auto const& e : other.entries_) {
+            (*this)[e.rule_name] += e.profile;
+        }
+    }
+
+    void clear() noexcept
+    {
+        entries_.clear();
+        interner_.clear();
+        pending_bytes_ = 0;
+    }
+
+    // Called by rules on entry. Returns the state to be passed to `leave`.
+    [[nodiscard]] profiler_rule_scope enter() noexcept
+    {
+        profiler_rule_scope const scope{
+            .outer_bytes = pending_bytes_,
+            .start_ticks = profiler_clock::now(),
+        };
+        pending_bytes_ = 0;
+        return scope;
+    }
+
+    // Called by rules on exit
+    void leave(
+        std::size_t const rule_slot, std::string_view const rule_name, profiler_rule_scope const& scope,
+        bool const ok, std::uint64_t const consumed_bytes
+    )
+    {
+        std::uint64_t const ticks = profiler_clock::now() - scope.start_ticks;
+
+        rule_profile& p = this->profile_at(interner_.index(rule_slot, rule_name));
+        ++p.calls;
+        p.ticks += ticks;
+
+        if (ok) {
+            ++p.successes;
+            p.consumed_bytes += consumed_bytes;
+            pending_bytes_ = scope.outer_bytes + consumed_bytes;
+        } else {
+            ++p.failures;
+            p.backtracked_bytes += pending_bytes_;
+            pending_bytes_ = scope.outer_bytes;
+        }
+    }
+
+private:
+    [[nodiscard]] rule_profile& profile_at(std::size_t const i)
+    {
+        if (i == entries_.size()) {
+            entries_.push_back(entry{interner_.names()[i], {}});
+        }
+        return entries_[i].profile;
+    }
+
+    std::vector<entry> entries_; // parallel to `interner_.names()`
+    detail::rule_interner interner_;
+
+    // Input consumed by the successful rules nested in the current invocation
+    std::uint64_t pending_bytes_ = 0;
+};
+
+} // iris::x4
+
+#endif
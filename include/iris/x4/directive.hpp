@@ -12,6 +12,7 @@
 
 #include <iris/config.hpp>
 #include <iris/x4/directive/as.hpp>
+#include <iris/x4/directive/dfa.hpp>
 #include <iris/x4/directive/expect.hpp>
 #include <iris/x4/directive/lexeme.hpp>
 #include <iris/x4/directive/matches.hpp>
@@ -19,8 +20,13 @@
 #include <iris/x4/directive/no_skip.hpp>
 #include <iris/x4/directive/omit.hpp>
 #include <iris/x4/directive/raw.hpp>
+#include <iris/x4/directive/recover.hpp>
+#include <iris/x4/directive/ref_attr.hpp>
 #include <iris/x4/directive/repeat.hpp>
+#include <iris/x4/directive/reserve.hpp>
 #include <iris/x4/directive/seek.hpp>
+#include <iris/x4/directive/seek_any.hpp>
+#include <iris/x4/directive/sink.hpp>
 #include <iris/x4/directive/skip.hpp>
 #include <iris/x4/directive/with.hpp>
 #include <iris/x4/directive/with_local.hpp>
@@ -0,0 +1,586 @@
+#ifndef IRIS_X4_DIRECTIVE_DFA_HPP
+#define IRIS_X4_DIRECTIVE_DFA_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/context.hpp>
+#include <iris/x4/core/parser.hpp>
+#include <iris/x4/core/skip_over.hpp>
+#include <iris/x4/core/unused.hpp>
+
+#include <iris/x4/char/char_parser.hpp>
+#include <iris/x4/string/case_compare.hpp>
+#include <iris/x4/string/literal_string.hpp>
+#include <iris/x4/string/literal_sequence.hpp>
+
+#include <iris/x4/operator/sequence.hpp>
+#include <iris/x4/operator/alternative.hpp>
+#include <iris/x4/operator/kleene.hpp>
+#include <iris/x4/operator/plus.hpp>
+#include <iris/x4/operator/optional.hpp>
+#include <iris/x4/operator/difference.hpp>
+
+#include <iris/x4/directive/lexeme.hpp>
+#include <iris/x4/directive/no_skip.hpp>
+#include <iris/x4/directive/no_case.hpp>
+#include <iris/x4/directive/omit.hpp>
+#include <iris/x4/directive/raw.hpp>
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace iris::x4 {
+
+namespace detail {
+
+using dfa_byte_set = std::bitset<256>;
+
+inline constexpr std::uint32_t dfa_npos = 0xFFFFFFFF;
+
+// Thompson NFA; each state has at most one byte-set transition
+struct dfa_nfa
+{
+    struct state
+    {
+        std::vector<std::uint32_t> eps;
+        dfa_byte_set set;
+        std::uint32_t next = dfa_npos;
+    };
+
+    struct fragment
+    {
+        std::uint32_t start;
+        std::uint32_t end;
+    };
+
+    std::uint32_t add_state()
+    {
+        states.emplace_back();
+        return static_cast<std::uint32_t>(states.size() - 1);
+    }
+
+    void add_eps(std::uint32_t from, std::uint32_t to)
+    {
+        states[from].eps.push_back(to);
+    }
+
+    fragment add_set(dfa_byte_set const& set)
+    {
+        auto const s = this->add_state();
+        auto const e = this->add_state();
+        states[s].set = set;
+        states[s].next = e;
+        return {s, e};
+    }
+
+    fragment add_empty()
+    {
+        auto const s = this->add_state();
+        return {s, s};
+    }
+
+    std::vector<state> states;
+};
+
+// Minimized DFA over byte classes. State 0 is the dead state.
+struct dfa_table
+{
+    std::array<std::uint8_t, 256> classes{};
+    std::uint32_t num_classes = 1;
+    std::uint32_t start = 0;
+    std::vector<std::uint32_t> trans; // [state * num_classes + class]
+    std::vector<std::uint8_t> accepting;
+
+    [[nodiscard]] std::size_t size() const noexcept { return accepting.size(); }
+
+    // Returns the end of the longest match starting at `first`, if any
+    template<std::forward_iterator It, std::sentinel_for<It> Se>
+    [[nodiscard]] constexpr bool
+    longest_match(It& first, Se const& last) const noexcept(noexcept(first != last) && noexcept(++first))
+    {
+        using char_type = std::iter_value_t<It>;
+
+        std::uint32_t s = start;
+        bool matched = accepting[s] != 0;
+        It match_end = first;
+
+        for (It it = first; it != last;) {
+            auto const byte = static_cast<std::make_unsigned_t<char_type>>(*it);
+            s = trans[s * num_classes + classes[byte]];
+            if (s == 0) break;
+            ++it;
+            if (accepting[s]) {
+                matched = true;
+                match_end = it;
+            }
+        }
+
+        if (matched) first = match_end;
+        return matched;
+    }
+};
+
+inline void dfa_closure(dfa_nfa const& nfa, std::vector<std::uint32_t>& set)
+{
+    std::vector<bool> seen(nfa.states.size());
+    for (auto const s : set) seen[s] = true;
+
+    for (std::size_t i = 0; i < set.size(); ++i) {
+        for (auto const t : nfa.states[set[i]].eps) {
+            if (!seen[t]) {
+                seen[t] = true;
+                set.push_back(t);
+            }
+        }
+    }
+    std::ranges::sort(set);
+}
+
+// Subset construction followed by Moore's partition refinement
+[[nodiscard]] inline dfa_table dfa_compile(dfa_nfa const& nfa, dfa_nfa::fragment const frag)
+{
+    dfa_table table;
+
+    // Partition the bytes into classes which no transition distinguishes
+    {
+        table.classes.fill(0);
+        std::uint32_t n = 1;
+        for (auto const& st : nfa.states) {
+            if (st.next == dfa_npos) continue;
+            std::map<std::pair<std::uint32_t, bool>, std::uint32_t> refined;
+            for (std::size_t b = 0; b < 256; ++b) {
+                auto const key = std::pair{std::uint32_t{table.classes[b]}, st.set.test(b)};
+                auto const [it, inserted] = refined.try_emplace(key, static_cast<std::uint32_t>(refined.size()));
+                table.classes[b] = static_cast<std::uint8_t>(it->second);
+            }
+            n = static_cast<std::uint32_t>(refined.size());
+        }
+        table.num_classes = n;
+    }
+
+    std::vector<std::size_t> representative(table.num_classes);
+    for (std::size_t b = 256; b-- > 0;) {
+        representative[table.classes[b]] = b;
+    }
+
+    std::uint32_t const nc = table.num_classes;
+    std::map<std::vector<std::uint32_t>, std::uint32_t> ids;
+    std::vector<std::vector<std::uint32_t>> subsets;
+    std::vector<std::uint32_t> trans;
+    std::vector<std::uint8_t> accepting;
+
+    auto const intern = [&](std::vector<std::uint32_t> set) {
+        auto const [it, inserted] = ids.try_emplace(set, static_cast<std::uint32_t>(subsets.size()));
+        if (inserted) {
+            accepting.push_back(std::ranges::binary_search(set, frag.end) ? 1 : 0);
+            subsets.push_back(std::move(set));
+            trans.resize(trans.size() + nc, 0);
+        }
+        return it->second;
+    };
+
+    intern({}); // dead state
+    std::vector<std::uint32_t> start_set{frag.start};
+    detail::dfa_closure(nfa, start_set);
+    std::uint32_t const start = intern(std::move(start_set));
+
+    for (std::uint32_t d = 0; d < subsets.size(); ++d) {
+        for (std::uint32_t c = 0; c < nc; ++c) {
+            std::vector<std::uint32_t> moved;
+            for (auto const s : subsets[d]) {
+                auto const& st = nfa.states[s];
+                if (st.next != dfa_npos && st.set.test(representative[c])) {
+                    moved.push_back(st.next);
+                }
+            }
+            if (moved.empty()) continue;
+            detail::dfa_closure(nfa, moved);
+            moved.erase(std::ranges::unique(moved).begin(), moved.end());
+            auto const target = intern(std::move(moved)); // may reallocate `subsets`
+            trans[d * nc + c] = target;
+        }
+    }
+
+    // Minimize; states which cannot reach an accepting state end up in the
+    // block of the dead state
+    std::size_t const n = subsets.size();
+    std::vector<std::uint32_t> block(n);
+    for (std::size_t s = 0; s < n; ++s) block[s] = accepting[s];
+    std::size_t num_blocks = 0;
+
+    while (true) {
+        std::map<std::vector<std::uint32_t>, std::uint32_t> signatures;
+        std::vector<std::uint32_t> next_block(n);
+
+        // Visit the dead state first, so that its block is numbered 0
+        for (std::size_t s = 0; s < n; ++s) {
+            std::vector<std::uint32_t> sig;
+            sig.reserve(nc + 1);
+            sig.push_back(block[s]);
+            for (std::uint32_t c = 0; c < nc; ++c) {
+                sig.push_back(block[trans[s * nc + c]]);
+            }
+            auto const [it, inserted] = signatures.try_emplace(std::move(sig), static_cast<std::uint32_t>(signatures.size()));
+            next_block[s] = it->second;
+        }
+
+        block = std::move(next_block);
+        if (signatures.size() == num_blocks) break;
+        num_blocks = signatures.size();
+    }
+
+    table.start = block[start];
+    table.trans.assign(num_blocks * nc, 0);
+    table.accepting.assign(num_blocks, 0);
+    for (std::size_t s = 0; s < n; ++s) {
+        auto const b = block[s];
+        table.accepting[b] = accepting[s];
+        for (std::uint32_t c = 0; c < nc; ++c) {
+            table.trans[b * nc + c] = block[trans[s * nc + c]];
+        }
+    }
+    return table;
+}
+
+// Parsers which match exactly one character from a set
+
+template<class P>
+struct dfa_char_settable : std::false_type {};
+
+template<class P>
+    requires
+        requires { typename P::encoding_type; } &&
+        std::is_base_of_v<char_parser<typename P::encoding_type, P>, P>
+struct dfa_char_settable<P> : std::bool_constant<sizeof(typename P::encoding_type::char_type) == 1> {};
+
+template<class Left, class Right>
+struct dfa_char_settable<difference<Left, Right>>
+    : std::bool_constant<dfa_char_settable<Left>::value && dfa_char_settable<Right>::value>
+{};
+
+template<class P>
+struct dfa_compilable : dfa_char_settable<P> {};
+
+template<class String, class Encoding, class Attr>
+struct dfa_compilable<literal_string<String, Encoding, Attr>>
+    : std::bool_constant<sizeof(typename Encoding::char_type) == 1>
+{};
+
+template<class Encoding, std::size_t N>
+struct dfa_compilable<literal_sequence<Encoding, N>>
+    : std::bool_constant<sizeof(typename Encoding::char_type) == 1>
+{};
+
+template<class Left, class Right>
+struct dfa_compilable<sequence<Left, Right>>
+    : std::bool_constant<dfa_compilable<Left>::value && dfa_compilable<Right>::value>
+{};
+
+template<class Left, class Right>
+struct dfa_compilable<alternative<Left, Right>>
+    : std::bool_constant<dfa_compilable<Left>::value && dfa_compilable<Right>::value>
+{};
+
+template<class S> struct dfa_compilable<kleene<S>> : dfa_compilable<S> {};
+template<class S> struct dfa_compilable<plus<S>> : dfa_compilable<S> {};
+template<class S> struct dfa_compilable<x4::optional<S>> : dfa_compilable<S> {};
+template<class S> struct dfa_compilable<lexeme_directive<S>> : dfa_compilable<S> {};
+template<class S> struct dfa_compilable<no_skip_directive<S>> : dfa_compilable<S> {};
+template<class S> struct dfa_compilable<no_case_directive<S>> : dfa_compilable<S> {};
+template<class S> struct dfa_compilable<omit_directive<S>> : dfa_compilable<S> {};
+template<class S> struct dfa_compilable<raw_directive<S>> : dfa_compilable<S> {};
+
+template<class P> constexpr bool dfa_is_sequence_v = false;
+template<class L, class R> constexpr bool dfa_is_sequence_v<sequence<L, R>> = true;
+
+template<class P> constexpr bool dfa_is_alternative_v = false;
+template<class L, class R> constexpr bool dfa_is_alternative_v<alternative<L, R>> = true;
+
+template<class P> constexpr bool dfa_is_kleene_v = false;
+template<class S> constexpr bool dfa_is_kleene_v<kleene<S>> = true;
+
+template<class P> constexpr bool dfa_is_plus_v = false;
+template<class S> constexpr bool dfa_is_plus_v<plus<S>> = true;
+
+template<class P> constexpr bool dfa_is_optional_v = false;
+template<class S> constexpr bool dfa_is_optional_v<x4::optional<S>> = true;
+
+template<class P> constexpr bool dfa_is_no_case_v = false;
+template<class S> constexpr bool dfa_is_no_case_v<no_case_directive<S>> = true;
+
+template<class P, class Context>
+[[nodiscard]] constexpr dfa_byte_set dfa_char_set(P const& p, Context const& ctx)
+{
+    if constexpr (requires { typename P::left_type; }) { // difference
+        return detail::dfa_char_set(p.left, ctx) & ~detail::dfa_char_set(p.right, ctx);
+    } else {
+        using char_type = typename P::encoding_type::char_type;
+        using classify_type = typename P::encoding_type::classify_type;
+
+        dfa_byte_set set;
+        for (std::size_t b = 0; b < 256; ++b) {
+            auto const ch = static_cast<char_type>(static_cast<std::make_unsigned_t<char_type>>(b));
+            if (p.test(static_cast<classify_type>(ch), ctx)) set.set(b);
+        }
+        return set;
+    }
+}
+
+template<class Encoding, class Context, class String>
+[[nodiscard]] dfa_nfa::fragment
+dfa_build_string(dfa_nfa& nfa, String const& str, Context const& ctx)
+{
+    using char_type = typename Encoding::char_type;
+    auto const compare = x4::get_case_compare<Encoding>(ctx);
+
+    auto frag = nfa.add_empty();
+    for (char_type const pattern_ch : str) {
+        dfa_byte_set set;
+        for (std::size_t b = 0; b < 256; ++b) {
+            auto const ch = static_cast<char_type>(static_cast<std::make_unsigned_t<char_type>>(b));
+            if (compare(pattern_ch, ch) == 0) set.set(b);
+        }
+        auto const next = nfa.add_set(set);
+        nfa.add_eps(frag.end, next.start);
+        frag.end = next.end;
+    }
+    return frag;
+}
+
+template<class P, class Context>
+[[nodiscard]] dfa_nfa::fragment
+dfa_build(dfa_nfa& nfa, P const& p, Context const& ctx)
+{
+    if constexpr (dfa_char_settable<P>::value) {
+        return nfa.add_set(detail::dfa_char_set(p, ctx));
+
+    } else if constexpr (requires { p.str; }) { // literal_string
+        return detail::dfa_build_string<typename P::encoding>(nfa, std::basic_string_view<typename P::char_type>(p.str), ctx);
+
+    } else if constexpr (requires { p.segments; }) { // literal_sequence
+        auto frag = nfa.add_empty();
+        for (auto const& seg : p.segments) {
+            auto const next = detail::dfa_build_string<typename P::encoding>(nfa, seg.chars(), ctx);
+            nfa.add_eps(frag.end, next.start);
+            frag.end = next.end;
+        }
+        return frag;
+
+    } else if constexpr (dfa_is_sequence_v<P>) {
+        auto const l = detail::dfa_build(nfa, p.left, ctx);
+        auto const r = detail::dfa_build(nfa, p.right, ctx);
+        nfa.add_eps(l.end, r.start);
+        return {l.start, r.end};
+
+    } else if constexpr (dfa_is_alternative_v<P>) {
+        auto const l = detail::dfa_build(nfa, p.left, ctx);
+        auto const r = detail::dfa_build(nfa, p.right, ctx);
+        auto const s = nfa.add_state();
+        auto const e = nfa.add_state();
+        nfa.add_eps(s, l.start);
+        nfa.add_eps(s, r.start);
+        nfa.add_eps(l.end, e);
+        nfa.add_eps(r.end, e);
+        return {s, e};
+
+    } else if constexpr (dfa_is_kleene_v<P>) {
+        auto const sub = detail::dfa_build(nfa, p.subject, ctx);
+        auto const s = nfa.add_state();
+        auto const e = nfa.add_state();
+        nfa.add_eps(s, sub.start);
+        nfa.add_eps(s, e);
+        nfa.add_eps(sub.end, sub.start);
+        nfa.add_eps(sub.end, e);
+        return {s, e};
+
+    } else if constexpr (dfa_is_plus_v<P>) {
+        auto const sub = detail::dfa_build(nfa, p.subject, ctx);
+        auto const e = nfa.add_state();
+        nfa.add_eps(sub.end, sub.start);
+        nfa.add_eps(sub.end, e);
+        return {sub.start, e};
+
+    } else if constexpr (dfa_is_optional_v<P>) {
+        auto const sub = detail::dfa_build(nfa, p.subject, ctx);
+        auto const s = nfa.add_state();
+        nfa.add_eps(s, sub.start);
+        nfa.add_eps(s, sub.end);
+        return {s, sub.end};
+
+    } else if constexpr (dfa_is_no_case_v<P>) {
+        return detail::dfa_build(
+            nfa, p.subject,
+            x4::make_context<detail::case_compare_tag>(detail::case_compare_no_case, ctx)
+        );
+
+    } else {
+        // lexeme, no_skip, omit, raw: the subject is matched without a skipper
+        // and the attribute is discarded anyway
+        return detail::dfa_build(nfa, p.subject, ctx);
+    }
+}
+
+// Tables for case-sensitive and `no_case` matching
+struct dfa_tables
+{
+    dfa_table case_sensitive;
+    dfa_table no_case;
+};
+
+template<class Subject>
+[[nodiscard]] std::shared_ptr<dfa_tables const> dfa_compile_tables(Subject const& subject)
+{
+    auto tables = std::make_shared<dfa_tables>();
+    {
+        dfa_nfa nfa;
+        auto const frag = detail::dfa_build(nfa, subject, unused);
+        tables->case_sensitive = detail::dfa_compile(nfa, frag);
+    }
+    {
+        dfa_nfa nfa;
+        auto const frag = detail::dfa_build(
+            nfa, subject,
+            x4::make_context<detail::case_compare_tag>(detail::case_compare_no_case)
+        );
+        tables->no_case = detail::dfa_compile(nfa, frag);
+    }
+    return tables;
+}
+
+} // detail
+
+// `dfa[p]` compiles a lexical pattern into a minimized DFA when the parser is
+// constructed, and matches it with a single table-driven loop instead of
+// recursive descent with per-character backtracking. Like `lexeme`, it
+// pre-skips and then matches without a skipper. The attribute is `unused`;
+// use `raw[dfa[p]]` to obtain the matched range.
+//
+// The subject may consist of char parsers (with a single-byte char type),
+// literals, `>>`, `|`, `*`, `+`, unary `-`, `a - b` where both operands match
+// a single char, and the directives `lexeme`, `no_skip`, `no_case`, `omit` and
+// `raw`. Anything else (including predicates such as `!p`, which look ahead
+// beyond the match) is rejected at compile time.
+//
+// The pattern is interpreted as a regular expression and the *longest* match
+// is taken. For token shapes such as `alpha >> *(alnum | '_')` this is what
+// the PEG would match too, but PEG operators are greedy and ordered:
+// `*alpha >> 'a'` never matches as a PEG, whereas `dfa[*alpha >> 'a']`
+// matches "aba", and `lit("a") | "ab"` matches "ab" entirely.
+//
+// The tables are shared between copies of the parser. As they are built at
+// runtime, `dfa[...]` cannot be used in constant expressions.
+template<class Subject>
+struct dfa_directive : unary_parser<Subject, dfa_directive<Subject>>
+{
+    using base_type = unary_parser<Subject, dfa_directive<Subject>>;
+    using attribute_type = unused_type;
+
+    static constexpr bool has_attribute = false;
+
+    static_assert(
+        detail::dfa_compilable<Subject>::value,
+        "`dfa[...]` only accepts char parsers with a single-byte char type, literals, "
+        "`>>`, `|`, `*`, `+`, unary `-`, char differences and lexical directives"
+    );
+
+    template<class SubjectT>
+        requires
+            (!std::is_same_v<std::remove_cvref_t<SubjectT>, dfa_directive>) &&
+            std::is_constructible_v<Subject, SubjectT>
+    explicit dfa_directive(SubjectT&& subject)
+        : base_type(std::forward<SubjectT>(subject))
+        , tables_(detail::dfa_compile_tables(this->subject))
+    {}
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
+    [[nodiscard]] bool
+    parse(It& first, Se const& last, Context const& ctx, Attr const&) const
+        noexcept(noexcept(x4::skip_over(first, last, ctx)) && noexcept(first != last) && noexcept(++first))
+    {
+        static_assert(sizeof(std::iter_value_t<It>) == 1, "`dfa[...]` requires single-byte characters");
+
+        x4::skip_over(first, last, ctx); // pre-skip
+
+        if constexpr (has_context_of_v<Context, detail::case_compare_tag, detail::case_compare_no_case_t>) {
+            return tables_->no_case.longest_match(first, last);
+        } else {
+            return tables_->case_sensitive.longest_match(first, last);
+        }
+    }
+
+    // Number of states in the minimized case-sensitive automaton
+    [[nodiscard]] std::size_t states() const noexcept
+    {
+        return tables_->case_sensitive.size();
+    }
+
+private:
+    std::shared_ptr<detail::dfa_tables const> tables_;
+};
+
+template<class Subject>
+struct get_info<dfa_directive<Subject>>
+{
+    using result_type = std::string;
+    [[nodiscard]] std::string operator()(dfa_directive<Subject> const& p) const
+    {
+        return "dfa[" + x4::what(p.subject) + "]";
+    }
+};
+
+namespace detail {
+
+inline constexpr std::string_view dfa_info_open = "dfa[";
+
+} // detail
+
+template<X4StaticInfo Subject>
+struct get_info<dfa_directive<Subject>>
+{
+    using result_type = std::string_view;
+    static constexpr std::string_view value =
+        detail::static_info_join<detail::dfa_info_open, get_info<Subject>::value, detail::info_close_bracket>::value;
+    [[nodiscard]] constexpr result_type operator()(dfa_directive<Subject> const&) const noexcept { return value; }
+};
+
+namespace detail {
+
+struct dfa_gen
+{
+    template<X4Subject Subject>
+    [[nodiscard]] dfa_directive<as_parser_plain_t<Subject>>
+    operator[](Subject&& subject) const
+    {
+        return dfa_directive<as_parser_plain_t<Subject>>(as_parser(std::forward<Subject>(subject)));
+    }
+};
+
+} // detail
+
+namespace parsers::directive {
+
+[[maybe_unused]] inline constexpr detail::dfa_gen dfa{};
+
+} // parsers::directive
+
+using parsers::directive::dfa;
+
+} // iris::x4
+
+#endif
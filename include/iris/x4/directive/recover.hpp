@@ -0,0 +1,168 @@
+#ifndef IRIS_X4_DIRECTIVE_RECOVER_HPP
+#define IRIS_X4_DIRECTIVE_RECOVER_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/x4/core/parser.hpp>
+#include <iris/x4/core/context.hpp>
+#include <iris/x4/core/expectation.hpp>
+#include <iris/x4/core/parse_budget.hpp>
+#include <iris/x4/core/unused.hpp>
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace iris::x4 {
+
+namespace contexts {
+
+// A container of `x4::expectation_failure<It>`, e.g. a `std::vector`, into
+// which `x4::recover(sync)[p]` appends the failures it recovers from.
+// `x4::parse_recovering` binds it automatically.
+struct recovered_failures
+{
+    static constexpr bool is_unique = true;
+};
+
+} // contexts
+
+// `recover(sync)[p]` parses `p`. If `p` fails with an expectation failure,
+// the failure is appended to `x4::contexts::recovered_failures` and cleared,
+// then the input is skipped from where the failure occurred up to and
+// including the first match of `sync`, or up to the end of input if there is
+// none, and the directive succeeds; the attribute of `p` is left as far as
+// it was filled. Any other failure of `p` is not recovered from, nor is an
+// expectation failure after which the input would be skipped to where `p`
+// started, e.g. at the end of input; the directive then fails with it.
+//
+// Typically used to skip a broken statement and go on with the next one:
+//
+//     *x4::recover(';')[statement]
+//
+// A failure reported by an exhausted `x4::parse_budget` is never recovered
+// from.
+template<class Subject, class Sync>
+struct recover_directive : proxy_parser<Subject, recover_directive<Subject, Sync>>
+{
+    using base_type = proxy_parser<Subject, recover_directive>;
+
+    template<class SubjectT, class SyncT>
+        requires std::is_constructible_v<base_type, SubjectT> && std::is_constructible_v<Sync, SyncT>
+    constexpr recover_directive(SubjectT&& subject, SyncT&& sync)
+        noexcept(std::is_nothrow_constructible_v<base_type, SubjectT> && std::is_nothrow_constructible_v<Sync, SyncT>)
+        : base_type(std::forward<SubjectT>(subject))
+        , sync_(std::forward<SyncT>(sync))
+    {}
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
+    [[nodiscard]] constexpr bool
+    parse(It& first, Se const& last, Context const& ctx, Attr& attr) const
+        // never noexcept (requires container insertion)
+    {
+        static_assert(
+            has_context_v<Context, contexts::recovered_failures>,
+            "Context type was not specified for `x4::contexts::recovered_failures`. "
+            "Use `x4::parse_recovering(...)`, or bind your own container: "
+            "`x4::with<x4::contexts::recovered_failures>(failures)[p]`."
+        );
+
+        It const start = first;
+        if (this->subject.parse(first, last, ctx, attr)) return true;
+        if (!x4::has_expectation_failure(ctx)) return false;
+
+        if constexpr (has_context_v<Context, contexts::budget>) {
+            if (x4::get<contexts::budget>(ctx).exhausted()) return false;
+        }
+
+        auto& failure = x4::get_expectation_failure(ctx);
+        It it = failure.where();
+        std::remove_cvref_t<decltype(failure)> recovered = std::move(failure);
+        x4::clear_expectation_failure(ctx);
+
+        auto const resume_at = [&](It&& resume) {
+            if (resume == start) {
+                // Nothing would be consumed, e.g. at the end of input, which
+                // would make a repetition of this directive loop forever
+                x4::get_expectation_failure(ctx) = std::move(recovered);
+                return false;
+            }
+            x4::get<contexts::recovered_failures>(ctx).push_back(std::move(recovered));
+            first = std::move(resume);
+            return true;
+        };
+
+        for (;;) {
+            if (!detail::budget_step(ctx, it)) {
+                x4::get<contexts::recovered_failures>(ctx).push_back(std::move(recovered));
+                return false;
+            }
+
+            It current = it;
+            if (sync_.parse(current, last, ctx, unused)) return resume_at(std::move(current));
+            if (x4::has_expectation_failure(ctx)) {
+                x4::get<contexts::recovered_failures>(ctx).push_back(std::move(recovered));
+                return false;
+            }
+
+            if (it == last) return resume_at(std::move(it));
+            ++it;
+        }
+    }
+
+private:
+    Sync sync_;
+};
+
+namespace detail {
+
+template<class Sync>
+struct [[nodiscard]] recover_gen_impl
+{
+    template<X4Subject Subject>
+    [[nodiscard]] constexpr recover_directive<as_parser_plain_t<Subject>, Sync>
+    operator[](Subject&& subject) const
+        noexcept(
+            is_parser_nothrow_castable_v<Subject> &&
+            std::is_nothrow_constructible_v<
+                recover_directive<as_parser_plain_t<Subject>, Sync>,
+                as_parser_t<Subject>,
+                Sync const&
+            >
+        )
+    {
+        return {as_parser(std::forward<Subject>(subject)), sync};
+    }
+
+    Sync sync;
+};
+
+struct recover_gen
+{
+    template<X4Subject Sync>
+    [[nodiscard]] static constexpr recover_gen_impl<as_parser_plain_t<Sync>>
+    operator()(Sync&& sync)
+        noexcept(is_parser_nothrow_castable_v<Sync> && std::is_nothrow_constructible_v<as_parser_plain_t<Sync>, as_parser_t<Sync>>)
+    {
+        return {as_parser(std::forward<Sync>(sync))};
+    }
+};
+
+} // detail
+
+namespace parsers::directive {
+
+[[maybe_unused]] inline constexpr detail::recover_gen recover{};
+
+} // parsers::directive
+
+using parsers::directive::recover;
+
+} // iris::x4
+
+#endif
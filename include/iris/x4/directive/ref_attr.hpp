@@ -0,0 +1,90 @@
+#ifndef IRIS_X4_DIRECTIVE_REF_ATTR_HPP
+#define IRIS_X4_DIRECTIVE_REF_ATTR_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/parser.hpp>
+#include <iris/x4/core/unused.hpp>
+#include <iris/x4/core/move_to.hpp>
+
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace iris::x4 {
+
+// `ref_attr[sym]` exposes `T const*` instead of a copy of the value stored in
+// a symbol table, so that a match costs a pointer store regardless of `T`.
+// The attribute may also be `std::reference_wrapper<T const>`.
+//
+// The subject must provide `parse_ref(first, last, ctx)`, which returns a
+// pointer to the stored value or `nullptr` on failure (see `symbols_parser_impl`).
+// The pointer refers into the subject's table, so it is invalidated by
+// removing the entry from (or clearing) the table. Note that parsers hold
+// their subjects by value: with `unique_symbols`, the table is owned by the
+// `ref_attr` parser object, which must then outlive the pointers. Copies of
+// `shared_symbols` share a single table.
+template<class Subject>
+struct ref_attr_directive : unary_parser<Subject, ref_attr_directive<Subject>>
+{
+    using value_type = typename Subject::value_type;
+    using attribute_type = value_type const*;
+
+    static constexpr bool has_attribute = true;
+    static constexpr bool handles_container = false;
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
+    [[nodiscard]] constexpr bool
+    parse(It& first, Se const& last, Context const& ctx, Attr& attr) const
+        noexcept(noexcept(std::declval<Subject const&>().parse_ref(first, last, ctx)))
+    {
+        static_assert(
+            requires { { this->subject.parse_ref(first, last, ctx) } -> std::convertible_to<value_type const*>; },
+            "`ref_attr[...]` requires a subject which provides `parse_ref` (e.g. symbols)"
+        );
+
+        value_type const* const ptr = this->subject.parse_ref(first, last, ctx);
+        if (!ptr) return false;
+
+        if constexpr (std::is_same_v<Attr, std::reference_wrapper<value_type const>>) {
+            attr = std::cref(*ptr);
+        } else if constexpr (!std::is_same_v<Attr, unused_type>) {
+            x4::move_to(attribute_type{ptr}, attr);
+        }
+        return true;
+    }
+};
+
+namespace detail {
+
+struct ref_attr_gen
+{
+    template<X4Subject Subject>
+    [[nodiscard]] constexpr ref_attr_directive<as_parser_plain_t<Subject>>
+    operator[](Subject&& subject) const
+        noexcept(is_parser_nothrow_constructible_v<ref_attr_directive<as_parser_plain_t<Subject>>, Subject>)
+    {
+        return {as_parser(std::forward<Subject>(subject))};
+    }
+};
+
+} // detail
+
+namespace parsers::directive {
+
+[[maybe_unused]] inline constexpr detail::ref_attr_gen ref_attr{};
+
+} // parsers::directive
+
+using parsers::directive::ref_attr;
+
+} // iris::x4
+
+#endif
@@ -16,7 +16,10 @@
 #include <iris/x4/core/parser.hpp>
 #include <iris/x4/operator/kleene.hpp>
 #include <iris/x4/core/expectation.hpp>
+#include <iris/x4/core/parse_budget.hpp>
+#include <iris/x4/traits/container_traits.hpp>
 
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <concepts>
@@ -38,6 +41,7 @@ struct exact_count // handles repeat(exact)[p]
     using value_type = T;
     [[nodiscard]] constexpr bool got_max(T i) const noexcept { return i >= exact_value; }
     [[nodiscard]] constexpr bool got_min(T i) const noexcept { return i >= exact_value; }
+    [[nodiscard]] constexpr T reserve_hint() const noexcept { return exact_value; }
 
     T exact_value;
 };
@@ -48,6 +52,8 @@ struct finite_count // handles repeat(min, max)[p]
     using value_type = T;
     [[nodiscard]] constexpr bool got_max(T i) const noexcept { return i >= max_value; }
     [[nodiscard]] constexpr bool got_min(T i) const noexcept { return i >= min_value; }
+    // `max_value` may be far beyond the actual count
+    [[nodiscard]] constexpr T reserve_hint() const noexcept { return min_value; }
 
     T min_value;
     T max_value;
@@ -59,6 +65,7 @@ struct infinite_count // handles repeat(min, inf)[p]
     using value_type = T;
     [[nodiscard]] constexpr bool got_max(T /*i*/) const noexcept { return false; }
     [[nodiscard]] constexpr bool got_min(T i) const noexcept { return i >= min_value; }
+    [[nodiscard]] constexpr T reserve_hint() const noexcept { return min_value; }
 
     T min_value;
 };
@@ -104,10 +111,22 @@ struct repeat_directive : proxy_parser<Subject, repeat_directive<Subject, Bounds
     parse(It& first, Se const& last, Context const& ctx, Attr& attr) const
         // never noexcept (requires container insertion)
     {
+        // Bounds may provide `reserve_hint()`, the number of elements to reserve
+        if constexpr (requires { { bounds_.reserve_hint() } -> std::integral; }) {
+            if constexpr (!X4UnusedAttribute<Attr>) {
+                if (auto const n = bounds_.reserve_hint(); n > 0) {
+                    traits::reserve(attr, static_cast<std::size_t>(n));
+                }
+            }
+        }
+
         It local_it = first;
         typename Bounds::value_type i{};
         for (; !bounds_.got_min(i); ++i) {
-            if (!detail::parse_into_container(this->subject, local_it, last, ctx, x4::assume_container(attr))) {
+            if (
+                !detail::budget_step(ctx, local_it) ||
+                !detail::parse_into_container(this->subject, local_it, last, ctx, x4::assume_container(attr))
+            ) {
                 return false;
             }
         }
@@ -115,7 +134,10 @@ struct repeat_directive : proxy_parser<Subject, repeat_directive<Subject, Bounds
         first = local_it;
         // parse some more up to the maximum specified
         for (; !bounds_.got_max(i); ++i) {
-            if (!detail::parse_into_container(this->subject, first, last, ctx, x4::assume_container(attr))) {
+            if (
+                !detail::budget_step(ctx, first) ||
+                !detail::parse_into_container(this->subject, first, last, ctx, x4::assume_container(attr))
+            ) {
                 break;
             }
         }
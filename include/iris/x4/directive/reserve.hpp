@@ -0,0 +1,198 @@
+#ifndef IRIS_X4_DIRECTIVE_RESERVE_HPP
+#define IRIS_X4_DIRECTIVE_RESERVE_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/parser.hpp>
+#include <iris/x4/core/unused.hpp>
+#include <iris/x4/traits/container_traits.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace iris::x4 {
+
+namespace detail {
+
+// reserve(n)[p]
+struct reserve_count
+{
+    template<std::forward_iterator It, std::sentinel_for<It> Se>
+    [[nodiscard]] constexpr std::size_t operator()(It const&, Se const&) const noexcept
+    {
+        return count;
+    }
+
+    std::size_t count;
+};
+
+// reserve_by_input(bytes_per_element, max_elements)[p]
+struct reserve_input_length
+{
+    template<std::forward_iterator It, std::sentinel_for<It> Se>
+    [[nodiscard]] constexpr std::size_t operator()(It const& first, Se const& last) const noexcept
+    {
+        if constexpr (std::contiguous_iterator<It> && std::sized_sentinel_for<Se, It>) {
+            auto const length = last - first;
+            if (length <= 0 || bytes_per_element == 0) return 0;
+            return std::min(
+                static_cast<std::size_t>(length) * sizeof(std::iter_value_t<It>) / bytes_per_element,
+                max_elements
+            );
+        } else {
+            // Measuring the input would cost a pass over it
+            (void)first;
+            (void)last;
+            return 0;
+        }
+    }
+
+    std::size_t bytes_per_element;
+    std::size_t max_elements = std::numeric_limits<std::size_t>::max();
+};
+
+} // detail
+
+// Reserves room in the container attribute before parsing the subject, for
+// the number of elements given by `hint(first, last)`, where `[first, last)`
+// is the remaining input. The hint only sizes the allocation; the elements
+// are still appended by the subject as usual. Attributes which are not
+// reservable containers are passed through untouched.
+//
+// The repetition parsers (`kleene`, `plus`, `list`) do not reserve on their
+// own: the number of elements is unknown before parsing, and any estimate
+// taken from the remaining input would be applied again by every nested
+// repetition. Reserving is therefore left to this directive, placed where the
+// user knows the estimate to hold.
+template<class Subject, class Hint>
+struct reserve_directive : proxy_parser<Subject, reserve_directive<Subject, Hint>>
+{
+    using base_type = proxy_parser<Subject, reserve_directive>;
+
+    template<class SubjectT, class HintT>
+        requires std::is_constructible_v<base_type, SubjectT> && std::is_constructible_v<Hint, HintT>
+    constexpr reserve_directive(SubjectT&& subject, HintT&& hint)
+        noexcept(std::is_nothrow_constructible_v<base_type, SubjectT> && std::is_nothrow_constructible_v<Hint, HintT>)
+        : base_type(std::forward<SubjectT>(subject))
+        , hint_(std::forward<HintT>(hint))
+    {}
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
+    [[nodiscard]] constexpr bool
+    parse(It& first, Se const& last, Context const& ctx, Attr& attr) const
+        // never noexcept (requires container allocation)
+    {
+        if constexpr (!X4UnusedAttribute<Attr>) {
+            static_assert(
+                std::convertible_to<std::invoke_result_t<Hint const&, It const&, Se const&>, std::size_t>,
+                "The reservation hint must be invocable as `hint(first, last)` returning the element count."
+            );
+            traits::reserve(attr, static_cast<std::size_t>(hint_(std::as_const(first), last)));
+        }
+        return this->subject.parse(first, last, ctx, attr);
+    }
+
+private:
+    Hint hint_;
+};
+
+namespace detail {
+
+template<class Hint>
+struct [[nodiscard]] reserve_gen_impl
+{
+    template<X4Subject Subject>
+    [[nodiscard]] constexpr reserve_directive<as_parser_plain_t<Subject>, Hint>
+    operator[](Subject&& subject) const
+        noexcept(
+            is_parser_nothrow_castable_v<Subject> &&
+            std::is_nothrow_constructible_v<
+                reserve_directive<as_parser_plain_t<Subject>, Hint>,
+                as_parser_t<Subject>,
+                Hint const&
+            >
+        )
+    {
+        return {as_parser(std::forward<Subject>(subject)), hint};
+    }
+
+    Hint hint;
+};
+
+struct reserve_gen
+{
+    [[nodiscard]] static constexpr reserve_gen_impl<reserve_count>
+    operator()(std::size_t const count) noexcept
+    {
+        return {reserve_count{count}};
+    }
+};
+
+struct reserve_by_gen
+{
+    template<class F>
+    [[nodiscard]] static constexpr reserve_gen_impl<std::remove_cvref_t<F>>
+    operator()(F&& f)
+        noexcept(std::is_nothrow_constructible_v<std::remove_cvref_t<F>, F>)
+    {
+        return {std::forward<F>(f)};
+    }
+};
+
+struct reserve_by_input_gen
+{
+    [[nodiscard]] static constexpr reserve_gen_impl<reserve_input_length>
+    operator()(std::size_t const bytes_per_element) noexcept
+    {
+        return {reserve_input_length{bytes_per_element}};
+    }
+
+    [[nodiscard]] static constexpr reserve_gen_impl<reserve_input_length>
+    operator()(std::size_t const bytes_per_element, std::size_t const max_elements) noexcept
+    {
+        return {reserve_input_length{bytes_per_element, max_elements}};
+    }
+};
+
+} // detail
+
+namespace parsers::directive {
+
+// reserve(n)[p]: reserves `n` elements
+[[maybe_unused]] inline constexpr detail::reserve_gen reserve{};
+
+// reserve_by(f)[p]: reserves `f(first, last)` elements
+[[maybe_unused]] inline constexpr detail::reserve_by_gen reserve_by{};
+
+// reserve_by_input(k)[p]: reserves one element per `k` bytes of the remaining
+// input, if it is contiguous with a sized sentinel; e.g. `k = 2` for
+// `int_ % ','` over single-digit numbers.
+// reserve_by_input(k, max)[p]: likewise, but reserves at most `max` elements.
+//
+// The remaining input is measured anew each time `p` is parsed. Inside a
+// repetition, e.g. `*('[' >> reserve_by_input(2)[int_ % ','] >> ']')`, every
+// inner container would reserve for the whole rest of the input, which is
+// quadratic in the input length overall. Use it on the outermost container
+// only, or bound it with `max`.
+[[maybe_unused]] inline constexpr detail::reserve_by_input_gen reserve_by_input{};
+
+} // parsers::directive
+
+using parsers::directive::reserve;
+using parsers::directive::reserve_by;
+using parsers::directive::reserve_by_input;
+
+} // iris::x4
+
+#endif
@@ -13,7 +13,9 @@
 ==============================================================================*/
 
 #include <iris/x4/core/parser.hpp>
+#include <iris/x4/core/rule_instrumentation.hpp>
 #include <iris/x4/core/expectation.hpp>
+#include <iris/x4/core/parse_budget.hpp>
 
 #include <iterator>
 #include <type_traits>
@@ -29,6 +31,8 @@ struct seek_directive : proxy_parser<Subject, seek_directive<Subject>>
     parse(It& first, Se const& last, Context const& ctx, Attr& attr) const
     {
         for (It current(first); ; ++current) {
+            if (!detail::budget_step(ctx, current)) return false;
+            detail::note_parse_start(ctx, current);
             if (this->subject.parse(current, last, ctx, attr)) {
                 first = current;
                 return true;
@@ -0,0 +1,129 @@
+#ifndef IRIS_X4_DIRECTIVE_SEEK_ANY_HPP
+#define IRIS_X4_DIRECTIVE_SEEK_ANY_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/parser.hpp>
+#include <iris/x4/core/skip_over.hpp>
+#include <iris/x4/core/move_to.hpp>
+#include <iris/x4/core/parse_budget.hpp>
+#include <iris/x4/core/unused.hpp>
+#include <iris/x4/traits/container_traits.hpp>
+#include <iris/x4/string/aho_corasick.hpp>
+
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <cassert>
+
+namespace iris::x4 {
+
+// `seek_any(sym)` behaves like `seek[sym]`: it skips input up to the
+// leftmost-longest occurrence of any key in `sym`, consumes it, and exposes
+// the associated value. Instead of retrying the symbol lookup at every input
+// position, the keys are compiled into an Aho-Corasick automaton which finds
+// the match in a single pass.
+//
+// The automaton is built from the entries of `sym` at construction time and
+// shared between copies of the parser; later modifications to `sym` are not
+// reflected. Keys are matched case-sensitively (`no_case` has no effect).
+template<class Encoding, class T>
+struct seek_any_parser : parser<seek_any_parser<Encoding, T>>
+{
+    using char_type = typename Encoding::char_type;
+    using encoding = Encoding;
+    using value_type = T;
+    using attribute_type = value_type;
+    using automaton_type = aho_corasick<char_type, T>;
+
+    static constexpr bool has_attribute = !std::is_same_v<attribute_type, unused_type>;
+    static constexpr bool handles_container = traits::is_container_v<attribute_type>;
+
+    seek_any_parser(std::shared_ptr<automaton_type const> automaton, std::string_view name = "symbols")
+        : automaton_(std::move(automaton))
+        , name_(name)
+    {
+        assert(automaton_ && automaton_->compiled());
+    }
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
+    [[nodiscard]] bool
+    parse(It& first, Se const& last, Context const& ctx, Attr& attr) const
+    {
+        x4::skip_over(first, last, ctx);
+
+        auto const m = automaton_->find(first, last, [&ctx](It const& it) {
+            return detail::budget_step(ctx, it);
+        });
+        if (!m) return false;
+
+        first = m->end;
+        x4::move_to(*m->value, attr);
+        return true;
+    }
+
+    [[nodiscard]] std::string get_x4_info() const
+    {
+        return "seek_any[" + name_ + "]";
+    }
+
+    [[nodiscard]] automaton_type const& automaton() const noexcept
+    {
+        return *automaton_;
+    }
+
+private:
+    std::shared_ptr<automaton_type const> automaton_;
+    std::string name_;
+};
+
+namespace detail {
+
+struct seek_any_fn
+{
+    // Accepts any symbol table providing `encoding`, `value_type`, `name()`
+    // and `for_each` (e.g. `unique_symbols`, `shared_symbols`)
+    template<class Symbols>
+        requires requires {
+            typename Symbols::encoding;
+            typename Symbols::value_type;
+        }
+    [[nodiscard]] static seek_any_parser<typename Symbols::encoding, typename Symbols::value_type>
+    operator()(Symbols const& sym)
+    {
+        using parser_type = seek_any_parser<typename Symbols::encoding, typename Symbols::value_type>;
+        using automaton_type = typename parser_type::automaton_type;
+        using char_type = typename parser_type::char_type;
+
+        auto automaton = std::make_shared<automaton_type>();
+        sym.for_each([&](std::basic_string_view<char_type> const key, auto const& val) {
+            automaton->add(key, val);
+        });
+        automaton->compile();
+        return parser_type(std::move(automaton), sym.name());
+    }
+};
+
+} // detail
+
+namespace parsers::directive {
+
+[[maybe_unused]] inline constexpr detail::seek_any_fn seek_any{};
+
+} // parsers::directive
+
+using parsers::directive::seek_any;
+
+} // iris::x4
+
+#endif
@@ -0,0 +1,249 @@
+#ifndef IRIS_X4_DIRECTIVE_SINK_HPP
+#define IRIS_X4_DIRECTIVE_SINK_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/parser.hpp>
+#include <iris/x4/core/unused.hpp>
+#include <iris/x4/core/validation.hpp>
+#include <iris/x4/traits/container_traits.hpp>
+
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace iris::x4 {
+
+// A container attribute which does not keep its elements, but hands each of
+// them to a callback as soon as it is pushed back. Every element is parsed
+// into the same buffer (see `traits::container_element_buffer`), which is
+// passed to the callback as an lvalue; move from it to keep the element.
+//
+// A default-constructed sink has no callback. It keeps the elements until it
+// is assigned to a sink with a callback, which then receives them. This
+// happens when some parser builds a temporary attribute of the same type.
+//
+// A sink with a callback is never empty: the elements it has delivered cannot
+// be taken back, so parsers which would otherwise parse straight into an
+// empty container and clear it on failure (e.g. `alternative`) parse into
+// such a temporary instead, and only the successful branch is delivered.
+template<class T, class F>
+class element_sink
+{
+public:
+    static_assert(!std::is_reference_v<T>);
+    static_assert(std::invocable<F&, T&>, "The sink callback must be invocable as `f(element&)`.");
+
+    using value_type = T;
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    constexpr element_sink() = default;
+
+    constexpr explicit element_sink(F& f) noexcept
+        : f_(&f)
+    {}
+
+    constexpr element_sink(element_sink const&) = default;
+    constexpr element_sink(element_sink&&) = default;
+
+    constexpr element_sink& operator=(element_sink const& other)
+    {
+        if (this == &other) return *this;
+        this->clear();
+        for (T const& value : other.pending_) {
+            this->push_back(value);
+        }
+        return *this;
+    }
+
+    constexpr element_sink& operator=(element_sink&& other)
+    {
+        if (this == &other) return *this;
+        this->clear();
+        for (T& value : other.pending_) {
+            this->push_back(std::move(value));
+        }
+        other.pending_.clear();
+        return *this;
+    }
+
+    [[nodiscard]] constexpr bool has_callback() const noexcept { return f_ != nullptr; }
+
+    constexpr iterator begin() noexcept { return pending_.begin(); }
+    constexpr iterator end() noexcept { return pending_.end(); }
+    constexpr const_iterator begin() const noexcept { return pending_.begin(); }
+    constexpr const_iterator end() const noexcept { return pending_.end(); }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return f_ == nullptr && pending_.empty(); }
+
+    // Elements which were already handed to the callback cannot be taken back
+    constexpr void clear() noexcept { pending_.clear(); }
+
+    template<class U>
+        requires std::constructible_from<T, U>
+    constexpr void push_back(U&& value)
+    {
+        if (f_ == nullptr) {
+            pending_.emplace_back(std::forward<U>(value));
+
+        } else if constexpr (std::same_as<U, T> || std::same_as<U, T&>) {
+            std::invoke(*f_, value);
+
+        } else {
+            T converted(std::forward<U>(value));
+            std::invoke(*f_, converted);
+        }
+    }
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se>
+    constexpr iterator insert(const_iterator /* end */, It first, Se last)
+    {
+        for (; first != last; ++first) {
+            this->push_back(*first);
+        }
+        return pending_.end();
+    }
+
+    // Resets the buffer which the next element is parsed into
+    [[nodiscard]] constexpr T& element_buffer()
+    {
+        if constexpr (traits::X4Container<T>) {
+            traits::clear(buffer_);
+        } else {
+            buffer_ = T{};
+        }
+        return buffer_;
+    }
+
+private:
+    F* f_ = nullptr;
+    std::vector<T> pending_;
+    T buffer_{};
+};
+
+namespace traits {
+
+template<class T, class F>
+struct container_element_buffer<element_sink<T, F>>
+{
+    [[nodiscard]] static constexpr T& call(element_sink<T, F>& sink)
+    {
+        return sink.element_buffer();
+    }
+};
+
+} // traits
+
+// `sink(f)[p]` parses the container attribute of `p`, typically a `kleene`,
+// `plus`, `list` or `repeat`, without materializing it: each element is handed
+// to `f` as soon as it is parsed, and the directive itself exposes no
+// attribute. Memory use is therefore independent of the number of elements.
+//
+// `f` is invoked with the element as an lvalue, in input order. Only elements
+// which were parsed successfully are delivered, but once delivered, an
+// element is not taken back if the enclosing parse eventually fails or
+// backtracks; `f` should not assume that the whole input matches. An
+// alternative directly under `sink` delivers the elements of its successful
+// branch only, after buffering them. Under `x4::validate`, nothing is
+// delivered.
+//
+// Each parse invokes its own copy of `f`, which may therefore be a mutable
+// callable; pass `std::ref(f)` to keep the state of `f` across parses.
+template<class Subject, class F>
+struct sink_directive : unary_parser<Subject, sink_directive<Subject, F>>
+{
+    using base_type = unary_parser<Subject, sink_directive>;
+    using attribute_type = unused_type;
+
+    static constexpr bool has_attribute = false;
+
+    template<class SubjectT, class FT>
+        requires std::is_constructible_v<base_type, SubjectT> && std::is_constructible_v<F, FT>
+    constexpr sink_directive(SubjectT&& subject, FT&& f)
+        noexcept(std::is_nothrow_constructible_v<base_type, SubjectT> && std::is_nothrow_constructible_v<F, FT>)
+        : base_type(std::forward<SubjectT>(subject))
+        , f_(std::forward<FT>(f))
+    {}
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
+    [[nodiscard]] constexpr bool
+    parse(It& first, Se const& last, Context const& ctx, Attr const&) const
+        // never noexcept (the callback may throw)
+    {
+        if constexpr (is_validating_v<Context>) {
+            return this->subject.parse(first, last, ctx, unused);
+
+        } else {
+            using subject_attribute_type = typename parser_traits<Subject>::attribute_type;
+            static_assert(
+                traits::X4Container<subject_attribute_type>,
+                "The subject of `sink(f)[p]` must expose a container attribute, e.g. `*p`, `+p`, `p % sep` or `repeat(n)[p]`."
+            );
+
+            F f = f_;
+            element_sink<traits::container_value_t<subject_attribute_type>, F> sink(f);
+            return this->subject.parse(first, last, ctx, sink);
+        }
+    }
+
+private:
+    F f_;
+};
+
+namespace detail {
+
+template<class F>
+struct [[nodiscard]] sink_gen_impl
+{
+    template<X4Subject Subject>
+    [[nodiscard]] constexpr sink_directive<as_parser_plain_t<Subject>, F>
+    operator[](Subject&& subject) const
+        noexcept(
+            is_parser_nothrow_castable_v<Subject> &&
+            std::is_nothrow_constructible_v<
+                sink_directive<as_parser_plain_t<Subject>, F>,
+                as_parser_t<Subject>,
+                F const&
+            >
+        )
+    {
+        return {as_parser(std::forward<Subject>(subject)), f};
+    }
+
+    F f;
+};
+
+struct sink_gen
+{
+    template<class F>
+    [[nodiscard]] static constexpr sink_gen_impl<std::remove_cvref_t<F>>
+    operator()(F&& f)
+        noexcept(std::is_nothrow_constructible_v<std::remove_cvref_t<F>, F>)
+    {
+        return {std::forward<F>(f)};
+    }
+};
+
+} // detail
+
+namespace parsers::directive {
+
+[[maybe_unused]] inline constexpr detail::sink_gen sink{};
+
+} // parsers::directive
+
+using parsers::directive::sink;
+
+} // iris::x4
+
+#endif
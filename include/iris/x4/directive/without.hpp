@@ -13,6 +13,8 @@
 
 #include <format>
 #include <iterator>
+#include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
@@ -34,15 +36,35 @@ struct without_directive : proxy_parser<Subject, without_directive<Subject, IDs.
     {
         return this->subject.parse(first, last, x4::remove_all_contexts<IDs...>(ctx), attr);
     }
+};
 
-    [[nodiscard]] constexpr std::string get_x4_info() const
+template<class Subject, class... IDs>
+struct get_info<without_directive<Subject, IDs...>>
+{
+    using result_type = std::string;
+    [[nodiscard]] constexpr std::string operator()(without_directive<Subject, IDs...> const& p) const
     {
-        return std::format("without<...>[{}]", get_info<Subject>{}(this->subject));
+        return std::format("without<...>[{}]", get_info<Subject>{}(p.subject));
     }
 };
 
 namespace detail {
 
+inline constexpr std::string_view without_info_open = "without<...>[";
+
+} // detail
+
+template<X4StaticInfo Subject, class... IDs>
+struct get_info<without_directive<Subject, IDs...>>
+{
+    using result_type = std::string_view;
+    static constexpr std::string_view value =
+        detail::static_info_join<detail::without_info_open, get_info<Subject>::value, detail::info_close_bracket>::value;
+    [[nodiscard]] constexpr result_type operator()(without_directive<Subject, IDs...> const&) const noexcept { return value; }
+};
+
+namespace detail {
+
 template<class... IDs>
 struct without_gen
 {
@@ -20,5 +20,6 @@
 #include <iris/x4/operator/plus.hpp>
 #include <iris/x4/operator/and_predicate.hpp>
 #include <iris/x4/operator/not_predicate.hpp>
+#include <iris/x4/operator/operator_precedence.hpp>
 
 #endif
@@ -11,6 +11,8 @@
     file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 =============================================================================*/
 
+#include <iris/x4/core/rule_instrumentation.hpp>
+#include <iris/x4/core/decision_log.hpp>
 #include <iris/x4/core/expectation.hpp>
 #include <iris/x4/core/parser.hpp>
 #include <iris/x4/core/move_to.hpp>
@@ -39,13 +41,24 @@ struct alternative : binary_parser<Left, Right, alternative<Left, Right>>
     [[nodiscard]] constexpr bool
     parse(It& first, Se const& last, Context const& ctx, unused_type) const
         noexcept(
+            !has_context_v<Context, contexts::decision_log> &&
+            !has_context_v<Context, contexts::backtrack_heatmap> &&
             is_nothrow_parsable_v<Left, It, Se, Context, unused_type> &&
             is_nothrow_parsable_v<Right, It, Se, Context, unused_type>
         )
     {
-        if constexpr (has_context_v<Context, contexts::expectation_failure>) {
+        if constexpr (has_context_v<Context, contexts::decision_log>) {
+            return detail::parse_logged_alternative(
+                ctx,
+                [&] { return this->left.parse(first, last, ctx, unused); },
+                [&] { return alternative::can_try_right(ctx, first) && this->right.parse(first, last, ctx, unused); }
+            );
+        } else if constexpr (
+            has_context_v<Context, contexts::expectation_failure> ||
+            has_context_v<Context, contexts::backtrack_heatmap>
+        ) {
             return this->left.parse(first, last, ctx, unused) ||
-                (!x4::has_expectation_failure(ctx) && this->right.parse(first, last, ctx, unused));
+                (alternative::can_try_right(ctx, first) && this->right.parse(first, last, ctx, unused));
         } else {
             return this->left.parse(first, last, ctx, unused) ||
                 this->right.parse(first, last, ctx, unused);
@@ -63,6 +76,8 @@ struct alternative : binary_parser<Left, Right, alternative<Left, Right>>
     [[nodiscard]] constexpr bool
     parse(It& first, Se const& last, Context const& ctx, Attr& attr) const
         noexcept(
+            !has_context_v<Context, contexts::decision_log> &&
+            !has_context_v<Context, contexts::backtrack_heatmap> &&
             noexcept(detail::parse_alternative(this->left, first, last, ctx, attr)) &&
             noexcept(detail::parse_alternative(this->right, first, last, ctx, attr)) &&
             std::is_nothrow_default_constructible_v<Attr> &&
@@ -77,25 +92,19 @@ struct alternative : binary_parser<Left, Right, alternative<Left, Right>>
             "Attribute needs to be default-initializable to support rollback on failed parse attempt."
         );
 
-        if (Attr attr_temp; detail::parse_alternative(this->left, first, last, ctx, attr_temp)) {
-            x4::move_to(std::move(attr_temp), attr);
-            return true;
-        }
-        if constexpr (has_context_v<Context, contexts::expectation_failure>) {
-            if (x4::has_expectation_failure(ctx)) return false;
-        }
-
-        if (Attr attr_temp; detail::parse_alternative(this->right, first, last, ctx, attr_temp)) {
-            x4::move_to(std::move(attr_temp), attr);
-            return true;
-        }
-        return false; // `attr` is untouched
+        return detail::parse_logged_alternative(
+            ctx,
+            [&] { return alternative::parse_branch(this->left, first, last, ctx, attr); },
+            [&] { return alternative::can_try_right(ctx, first) && alternative::parse_branch(this->right, first, last, ctx, attr); }
+        );
     }
 
     template<std::forward_iterator It, std::sentinel_for<It> Se, class Context, traits::X4Container ContainerAttr>
     [[nodiscard]] constexpr bool
     parse(It& first, Se const& last, Context const& ctx, ContainerAttr& attr) const
         noexcept(
+            !has_context_v<Context, contexts::decision_log> &&
+            !has_context_v<Context, contexts::backtrack_heatmap> &&
             noexcept(detail::parse_alternative(this->left, first, last, ctx, attr)) &&
             noexcept(detail::parse_alternative(this->right, first, last, ctx, attr)) &&
             noexcept(x4::move_to(std::declval<ContainerAttr>(), attr)) &&
@@ -115,20 +124,25 @@ struct alternative : binary_parser<Left, Right, alternative<Left, Right>>
         // is empty; assuming that the "empty" state of any user-provided container
         // class is monostate.
         if (traits::is_empty(attr)) {
-            if (detail::parse_alternative(this->left, first, last, ctx, attr)) {
-                return true;
-            }
-            traits::clear(attr); // Make sure we don't propagate observable side effect
-
-            if constexpr (has_context_v<Context, contexts::expectation_failure>) {
-                if (x4::has_expectation_failure(ctx)) return false;
-            }
-
-            if (detail::parse_alternative(this->right, first, last, ctx, attr)) {
-                return true;
-            }
-            traits::clear(attr); // Make sure we don't propagate observable side effect
-            return false;
+            return detail::parse_logged_alternative(
+                ctx,
+                [&] {
+                    if (detail::parse_alternative(this->left, first, last, ctx, attr)) {
+                        return true;
+                    }
+                    traits::clear(attr); // Make sure we don't propagate observable side effect
+                    return false;
+                },
+                [&] {
+                    if (!alternative::can_try_right(ctx, first)) return false;
+
+                    if (detail::parse_alternative(this->right, first, last, ctx, attr)) {
+                        return true;
+                    }
+                    traits::clear(attr); // Make sure we don't propagate observable side effect
+                    return false;
+                }
+            );
         }
 
         //
@@ -137,21 +151,59 @@ struct alternative : binary_parser<Left, Right, alternative<Left, Right>>
         //
         unwrap_container_appender_t<ContainerAttr> attr_temp;
 
-        if (detail::parse_alternative(this->left, first, last, ctx, attr_temp)) {
-            x4::move_to(std::move(attr_temp), attr);
-            return true;
+        return detail::parse_logged_alternative(
+            ctx,
+            [&] {
+                if (detail::parse_alternative(this->left, first, last, ctx, attr_temp)) {
+                    x4::move_to(std::move(attr_temp), attr);
+                    return true;
+                }
+                return false;
+            },
+            [&] {
+                if (!alternative::can_try_right(ctx, first)) return false;
+                traits::clear(attr_temp); // Reuse the buffer
+
+                if (detail::parse_alternative(this->right, first, last, ctx, attr_temp)) {
+                    x4::move_to(std::move(attr_temp), attr);
+                    return true;
+                }
+                return false; // `attr` is untouched
+            }
+        );
+    }
+
+private:
+    template<class Subject, std::forward_iterator It, std::sentinel_for<It> Se, class Context, class Attr>
+    [[nodiscard]] static constexpr bool
+    parse_branch(Subject const& subject, It& first, Se const& last, Context const& ctx, Attr& attr)
+    {
+        if constexpr (detail::is_transactional_alternative_v<Subject, It, Se, Context, Attr>) {
+            // The branch builds its own attribute and assigns `attr` only on
+            // success, e.g. the `int` of `rvariant<int, ast>` is moved straight
+            // into the variant
+            return detail::parse_alternative(subject, first, last, ctx, attr);
+
+        } else {
+            if (Attr attr_temp; detail::parse_alternative(subject, first, last, ctx, attr_temp)) {
+                x4::move_to(std::move(attr_temp), attr);
+                return true;
+            }
+            return false; // `attr` is untouched
         }
+    }
 
+    // The right branch is not tried after an expectation failure in the left
+    // one. Otherwise, the retry from `first` is recorded to the heatmap, if any.
+    template<class Context, std::forward_iterator It>
+    [[nodiscard]] static constexpr bool can_try_right(Context const& ctx, It const& first)
+        noexcept(!has_context_v<Context, contexts::backtrack_heatmap>)
+    {
         if constexpr (has_context_v<Context, contexts::expectation_failure>) {
             if (x4::has_expectation_failure(ctx)) return false;
         }
-        traits::clear(attr_temp); // Reuse the buffer
-
-        if (detail::parse_alternative(this->right, first, last, ctx, attr_temp)) {
-            x4::move_to(std::move(attr_temp), attr);
-            return true;
-        }
-        return false; // `attr` is untouched
+        detail::note_parse_start(ctx, first);
+        return true;
     }
 };
 
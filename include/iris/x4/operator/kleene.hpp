@@ -16,6 +16,7 @@
 #include <iris/x4/core/detail/parse_into_container.hpp>
 #include <iris/x4/core/unused.hpp>
 #include <iris/x4/core/expectation.hpp>
+#include <iris/x4/core/parse_budget.hpp>
 
 #include <iris/x4/traits/container_traits.hpp>
 
@@ -35,10 +36,15 @@ struct kleene : unary_parser<Subject, kleene<Subject>>
     template<std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
     [[nodiscard]] constexpr bool
     parse(It& first, Se const& last, Context const& ctx, Attr& attr) const
-        noexcept(noexcept(detail::parse_into_container(this->subject, first, last, ctx, x4::assume_container(attr))))
+        noexcept(
+            noexcept(detail::budget_step(ctx, first)) &&
+            noexcept(detail::parse_into_container(this->subject, first, last, ctx, x4::assume_container(attr)))
+        )
     {
-        while (detail::parse_into_container(this->subject, first, last, ctx, x4::assume_container(attr)))
-            /* loop */;
+        while (
+            detail::budget_step(ctx, first) &&
+            detail::parse_into_container(this->subject, first, last, ctx, x4::assume_container(attr))
+        ) /* loop */;
 
         if constexpr (has_context_v<Context, contexts::expectation_failure>) {
             return !x4::has_expectation_failure(ctx);
@@ -13,8 +13,10 @@
 =============================================================================*/
 
 #include <iris/x4/core/parser.hpp>
+#include <iris/x4/core/rule_instrumentation.hpp>
 #include <iris/x4/core/detail/parse_into_container.hpp>
 #include <iris/x4/core/expectation.hpp>
+#include <iris/x4/core/parse_budget.hpp>
 #include <iris/x4/core/unused.hpp>
 
 #include <iris/x4/traits/container_traits.hpp>
@@ -38,6 +40,8 @@ struct list : binary_parser<Left, Right, list<Left, Right>>
     [[nodiscard]] constexpr bool
     parse(It& first, Se const& last, Context const& ctx, Attr& attr) const
         noexcept(
+            !has_context_v<Context, contexts::backtrack_heatmap> &&
+            noexcept(detail::budget_step(ctx, first)) &&
             noexcept(detail::parse_into_container(this->left, first, last, ctx, x4::assume_container(attr))) &&
             std::is_nothrow_copy_assignable_v<It> &&
             is_nothrow_parsable_v<Right, It, Se, Context, unused_type>
@@ -50,12 +54,15 @@ struct list : binary_parser<Left, Right, list<Left, Right>>
 
         It last_parse_it = first;
         while (
+            detail::budget_step(ctx, first) &&
             this->right.parse(last_parse_it, last, ctx, unused) &&
             detail::parse_into_container(this->left, last_parse_it, last, ctx, x4::assume_container(attr))
         ) {
             // TODO: can we reduce this copy assignment?
             first = last_parse_it;
         }
+        // A trailing separator is given back
+        detail::note_rollback(ctx, first, last_parse_it);
 
         if constexpr (has_context_v<Context, contexts::expectation_failure>) {
             return !x4::has_expectation_failure(ctx);
@@ -0,0 +1,364 @@
+#ifndef IRIS_X4_OPERATOR_OPERATOR_PRECEDENCE_HPP
+#define IRIS_X4_OPERATOR_OPERATOR_PRECEDENCE_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/expectation.hpp>
+#include <iris/x4/core/parser.hpp>
+#include <iris/x4/core/skip_over.hpp>
+#include <iris/x4/core/move_to.hpp>
+#include <iris/x4/core/parse_budget.hpp>
+#include <iris/x4/core/unused.hpp>
+#include <iris/x4/char_encoding/standard.hpp>
+#include <iris/x4/string/case_compare.hpp>
+#include <iris/x4/string/tst.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace iris::x4 {
+
+enum class assoc : unsigned char
+{
+    left,
+    right,
+    none, // `a < b < c` is not parsed beyond `a < b`
+};
+
+// A flat table of prefix, infix and postfix operators for
+// `operator_precedence`. Each operator is a token, a precedence (greater
+// values bind tighter) and a callback which builds the value of type `T` for
+// the operation from the values of its operands.
+//
+// Tokens are matched like `symbols` keys, i.e. the longest token wins, also
+// between a postfix and an infix operator following an operand (e.g. `!=`
+// over `!`). Adding a token which already exists in the same position
+// (prefix, infix or postfix) replaces the operator.
+template<class T, class Encoding = char_encoding::standard>
+struct operator_table
+{
+    using encoding = Encoding;
+    using char_type = typename Encoding::char_type;
+    using value_type = T;
+
+    using unary_function = std::function<T(T)>;
+    using binary_function = std::function<T(T, T)>;
+
+    struct unary_operator
+    {
+        int precedence;
+        unary_function fn;
+    };
+
+    struct binary_operator
+    {
+        int precedence;
+        x4::assoc assoc;
+        binary_function fn;
+    };
+
+    operator_table& prefix(std::basic_string_view<char_type> const token, int precedence, unary_function fn)
+    {
+        operator_table::add(prefix_tokens_, prefix_, token, unary_operator{precedence, std::move(fn)});
+        return *this;
+    }
+
+    operator_table& infix(std::basic_string_view<char_type> const token, int precedence, x4::assoc assoc, binary_function fn)
+    {
+        operator_table::add(infix_tokens_, infix_, token, binary_operator{precedence, assoc, std::move(fn)});
+        return *this;
+    }
+
+    operator_table& postfix(std::basic_string_view<char_type> const token, int precedence, unary_function fn)
+    {
+        operator_table::add(postfix_tokens_, postfix_, token, unary_operator{precedence, std::move(fn)});
+        return *this;
+    }
+
+    // Limits the nesting of operands, i.e. the number of prefix operators
+    // and right operands being parsed at once. Deeper expressions fail to
+    // parse instead of overflowing the stack.
+    operator_table& max_depth(std::size_t const depth) noexcept
+    {
+        max_depth_ = depth;
+        return *this;
+    }
+
+    [[nodiscard]] std::size_t max_depth() const noexcept { return max_depth_; }
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class CaseCompare>
+    [[nodiscard]] unary_operator const* find_prefix(It& first, Se const& last, CaseCompare const& comp) const noexcept
+    {
+        return operator_table::find(prefix_tokens_, prefix_, first, last, comp);
+    }
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class CaseCompare>
+    [[nodiscard]] binary_operator const* find_infix(It& first, Se const& last, CaseCompare const& comp) const noexcept
+    {
+        return operator_table::find(infix_tokens_, infix_, first, last, comp);
+    }
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class CaseCompare>
+    [[nodiscard]] unary_operator const* find_postfix(It& first, Se const& last, CaseCompare const& comp) const noexcept
+    {
+        return operator_table::find(postfix_tokens_, postfix_, first, last, comp);
+    }
+
+    [[nodiscard]] bool has_prefix() const noexcept { return !prefix_.empty(); }
+    [[nodiscard]] bool has_postfix() const noexcept { return !postfix_.empty(); }
+
+private:
+    template<class Op>
+    static void add(tst<char_type, std::size_t>& tokens, std::vector<Op>& ops, std::basic_string_view<char_type> const token, Op op)
+    {
+        if (token.empty()) return;
+        std::size_t* const index = tokens.add(token.begin(), token.end(), ops.size());
+        if (*index == ops.size()) {
+            ops.push_back(std::move(op));
+        } else {
+            ops[*index] = std::move(op);
+        }
+    }
+
+    template<class Op, std::forward_iterator It, std::sentinel_for<It> Se, class CaseCompare>
+    [[nodiscard]] static Op const*
+    find(tst<char_type, std::size_t> const& tokens, std::vector<Op> const& ops, It& first, Se const& last, CaseCompare const& comp) noexcept
+    {
+        std::size_t const* const index = tokens.find(first, last, comp);
+        return index ? &ops[*index] : nullptr;
+    }
+
+    tst<char_type, std::size_t> prefix_tokens_, infix_tokens_, postfix_tokens_;
+    std::vector<unary_operator> prefix_, postfix_;
+    std::vector<binary_operator> infix_;
+    std::size_t max_depth_ = 1024;
+};
+
+// `operator_precedence(operand, table)` parses expressions made of operands
+// and the operators in `table` by precedence climbing, exposing the value
+// built by the operator callbacks. It replaces the usual tower of one rule
+// per precedence level:
+//
+//     auto const table = x4::operator_table<ast>{}
+//         .infix("+", 10, x4::assoc::left, make_add)
+//         .infix("*", 20, x4::assoc::left, make_mul)
+//         .infix("^", 30, x4::assoc::right, make_pow)
+//         .prefix("-", 25, make_neg);
+//     auto const expr_def = x4::operator_precedence(primary, table);
+//
+// Parsing an operand costs one call to `operand` regardless of the number of
+// precedence levels. The operator tokens are pre-skipped. If the right
+// operand of an infix operator fails to parse, the operator is left
+// unconsumed and the expression ends before it (unless an expectation
+// failure has occurred, in which case the parse fails). A prefix operator
+// which is not followed by an operand is retried as part of an operand. An
+// expression nested deeper than `table.max_depth()` fails to parse.
+//
+// The operand's attribute must be compatible with `T`, and `T` must be
+// default constructible and movable. The table is shared between copies of
+// the parser.
+template<class Operand, class T, class Encoding>
+struct operator_precedence_parser : unary_parser<Operand, operator_precedence_parser<Operand, T, Encoding>>
+{
+    using base_type = unary_parser<Operand, operator_precedence_parser<Operand, T, Encoding>>;
+    using table_type = operator_table<T, Encoding>;
+    using attribute_type = T;
+
+    static constexpr bool has_attribute = true;
+    static constexpr bool handles_container = false;
+
+    operator_precedence_parser(Operand operand, std::shared_ptr<table_type const> table)
+        : base_type(std::move(operand))
+        , table_(std::move(table))
+    {}
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
+    [[nodiscard]] bool
+    parse(It& first, Se const& last, Context const& ctx, Attr& attr) const
+    {
+        T value{};
+        nesting nest{.depth_left = table_->max_depth()};
+        if (!this->parse_expr(first, last, ctx, std::numeric_limits<int>::min(), nest, value)) return false;
+
+        if constexpr (!std::is_same_v<std::remove_const_t<Attr>, unused_type>) {
+            x4::move_to(std::move(value), attr);
+        }
+        return true;
+    }
+
+    [[nodiscard]] table_type const& table() const noexcept
+    {
+        return *table_;
+    }
+
+    [[nodiscard]] std::string get_x4_info() const
+    {
+        return "operator_precedence[" + x4::what(this->subject) + "]";
+    }
+
+private:
+    struct nesting
+    {
+        std::size_t depth_left;
+        bool too_deep = false;
+    };
+
+    template<class Context>
+    [[nodiscard]] static bool expectation_failed(Context const& ctx) noexcept
+    {
+        if constexpr (has_context_v<Context, contexts::expectation_failure>) {
+            return x4::has_expectation_failure(ctx);
+        } else {
+            return false;
+        }
+    }
+
+    // Whether the parse must fail instead of backtracking
+    template<class Context>
+    [[nodiscard]] static bool aborted(Context const& ctx, nesting const& nest) noexcept
+    {
+        return nest.too_deep || expectation_failed(ctx);
+    }
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Context>
+    [[nodiscard]] bool
+    parse_operand(It& first, Se const& last, Context const& ctx, nesting& nest, T& lhs) const
+    {
+        if (table_->has_prefix()) {
+            It it = first;
+            x4::skip_over(it, last, ctx);
+            if (auto const* op = table_->find_prefix(it, last, x4::get_case_compare<Encoding>(ctx))) {
+                T operand{};
+                if (this->parse_expr(it, last, ctx, op->precedence, nest, operand)) {
+                    lhs = op->fn(std::move(operand));
+                    first = it;
+                    return true;
+                }
+                if (aborted(ctx, nest)) return false;
+            }
+        }
+        return this->subject.parse(first, last, ctx, lhs);
+    }
+
+    // Parses an operand and the operators binding at least as tightly as
+    // `min_precedence`, committing to `first` only on success
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Context>
+    [[nodiscard]] bool
+    parse_expr(It& first, Se const& last, Context const& ctx, int const min_precedence, nesting& nest, T& lhs) const
+    {
+        if (nest.depth_left == 0) [[unlikely]] {
+            nest.too_deep = true;
+            if constexpr (has_context_v<Context, contexts::expectation_failure>) {
+                auto& failure = x4::get<contexts::expectation_failure>(ctx);
+                if (!failure.has_value()) failure.emplace(first, "(operator_precedence: nesting too deep)");
+            }
+            return false;
+        }
+
+        --nest.depth_left;
+        It pos = first;
+        bool const ok = this->parse_expr_from(pos, last, ctx, min_precedence, nest, lhs);
+        ++nest.depth_left;
+        if (ok) first = pos;
+        return ok;
+    }
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Context>
+    [[nodiscard]] bool
+    parse_expr_from(It& first, Se const& last, Context const& ctx, int const min_precedence, nesting& nest, T& lhs) const
+    {
+        if (!this->parse_operand(first, last, ctx, nest, lhs)) return false;
+
+        auto const& compare = x4::get_case_compare<Encoding>(ctx);
+        std::optional<int> nonassoc_precedence;
+
+        while (true) {
+            if (!detail::budget_step(ctx, first)) return false;
+
+            It it = first;
+            x4::skip_over(it, last, ctx);
+
+            // The longer of the postfix and the infix tokens, if any, the
+            // postfix one on a tie
+            It infix_it = it;
+            auto const* op = table_->find_infix(infix_it, last, compare);
+
+            if (table_->has_postfix()) {
+                It postfix_it = it;
+                if (auto const* postfix_op = table_->find_postfix(postfix_it, last, compare)) {
+                    if (!op || std::ranges::distance(it, postfix_it) >= std::ranges::distance(it, infix_it)) {
+                        if (postfix_op->precedence < min_precedence) break;
+                        lhs = postfix_op->fn(std::move(lhs));
+                        first = postfix_it;
+                        nonassoc_precedence.reset();
+                        continue;
+                    }
+                }
+            }
+
+            if (!op || op->precedence < min_precedence) break;
+            if (nonassoc_precedence == op->precedence) break;
+
+            int const rhs_precedence = op->assoc == assoc::right ? op->precedence : op->precedence + 1;
+            T rhs{};
+            if (!this->parse_expr(infix_it, last, ctx, rhs_precedence, nest, rhs)) {
+                if (aborted(ctx, nest)) return false;
+                break; // leave the operator unconsumed
+            }
+
+            lhs = op->fn(std::move(lhs), std::move(rhs));
+            first = infix_it;
+            if (op->assoc == assoc::none) {
+                nonassoc_precedence = op->precedence;
+            } else {
+                nonassoc_precedence.reset();
+            }
+        }
+        return true;
+    }
+
+    std::shared_ptr<table_type const> table_;
+};
+
+namespace detail {
+
+struct operator_precedence_fn
+{
+    template<X4Subject Operand, class T, class Encoding>
+    [[nodiscard]] static operator_precedence_parser<as_parser_plain_t<Operand>, T, Encoding>
+    operator()(Operand&& operand, operator_table<T, Encoding> table)
+    {
+        return {
+            as_parser(std::forward<Operand>(operand)),
+            std::make_shared<operator_table<T, Encoding> const>(std::move(table))
+        };
+    }
+};
+
+} // detail
+
+inline namespace cpos {
+
+[[maybe_unused]] inline constexpr detail::operator_precedence_fn operator_precedence{};
+
+} // cpos
+
+} // iris::x4
+
+#endif
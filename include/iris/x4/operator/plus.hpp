@@ -15,6 +15,7 @@
 #include <iris/x4/core/parser.hpp>
 #include <iris/x4/core/unused.hpp>
 #include <iris/x4/core/expectation.hpp>
+#include <iris/x4/core/parse_budget.hpp>
 #include <iris/x4/core/detail/parse_into_container.hpp>
 
 #include <iris/x4/traits/container_traits.hpp>
@@ -35,14 +36,19 @@ struct plus : unary_parser<Subject, plus<Subject>>
     template<std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
     [[nodiscard]] constexpr bool
     parse(It& first, Se const& last, Context const& ctx, Attr& attr) const
-        noexcept(noexcept(detail::parse_into_container(this->subject, first, last, ctx, x4::assume_container(attr))))
+        noexcept(
+            noexcept(detail::budget_step(ctx, first)) &&
+            noexcept(detail::parse_into_container(this->subject, first, last, ctx, x4::assume_container(attr)))
+        )
     {
         if (!detail::parse_into_container(this->subject, first, last, ctx, x4::assume_container(attr))) {
             return false;
         }
 
-        while (detail::parse_into_container(this->subject, first, last, ctx, x4::assume_container(attr)))
-            /* loop */;
+        while (
+            detail::budget_step(ctx, first) &&
+            detail::parse_into_container(this->subject, first, last, ctx, x4::assume_container(attr))
+        ) /* loop */;
 
         if constexpr (has_context_v<Context, contexts::expectation_failure>) {
             return !x4::has_expectation_failure(ctx);
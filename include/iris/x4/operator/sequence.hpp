@@ -11,6 +11,7 @@
     file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 =============================================================================*/
 
+#include <iris/x4/core/rule_instrumentation.hpp>
 #include <iris/x4/core/expectation.hpp>
 #include <iris/x4/core/parser.hpp>
 #include <iris/x4/core/detail/parse_sequence.hpp>
@@ -42,6 +43,7 @@ struct sequence : binary_parser<Left, Right, sequence<Left, Right>>
     [[nodiscard]] constexpr bool
     parse(It& first, Se const& last, Context const& ctx, unused_type) const
         noexcept(
+            !has_context_v<Context, contexts::backtrack_heatmap> &&
             std::is_nothrow_copy_assignable_v<It> &&
             is_nothrow_parsable_v<Left, It, Se, Context, unused_type> &&
             is_nothrow_parsable_v<Right, It, Se, Context, unused_type>
@@ -62,6 +64,7 @@ struct sequence : binary_parser<Left, Right, sequence<Left, Right>>
             }
         }
 
+        detail::note_rollback(ctx, first_saved, first);
         first = first_saved;
         return false;
     }
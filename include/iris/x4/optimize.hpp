@@ -0,0 +1,499 @@
+#ifndef IRIS_X4_OPTIMIZE_HPP
+#define IRIS_X4_OPTIMIZE_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/parser.hpp>
+#include <iris/x4/core/unused.hpp>
+
+#include <iris/x4/char/literal_char.hpp>
+#include <iris/x4/char/char_set.hpp>
+#include <iris/x4/string/literal_string.hpp>
+#include <iris/x4/string/literal_sequence.hpp>
+
+#include <iris/x4/operator/sequence.hpp>
+#include <iris/x4/operator/alternative.hpp>
+#include <iris/x4/operator/kleene.hpp>
+#include <iris/x4/operator/plus.hpp>
+#include <iris/x4/operator/optional.hpp>
+#include <iris/x4/operator/list.hpp>
+#include <iris/x4/operator/difference.hpp>
+#include <iris/x4/operator/and_predicate.hpp>
+#include <iris/x4/operator/not_predicate.hpp>
+
+#include <iris/x4/directive/omit.hpp>
+#include <iris/x4/directive/lexeme.hpp>
+#include <iris/x4/directive/no_skip.hpp>
+#include <iris/x4/directive/no_case.hpp>
+#include <iris/x4/directive/raw.hpp>
+#include <iris/x4/directive/matches.hpp>
+#include <iris/x4/directive/expect.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace iris::x4 {
+
+namespace detail {
+
+// Attribute-less literals which can be fused into a `literal_sequence`.
+// String literals are only fused when they do not own their characters, as
+// the `literal_sequence` refers to them.
+
+template<class P>
+struct optimize_literal : std::false_type {};
+
+template<class Encoding>
+struct optimize_literal<literal_char<Encoding, unused_type>> : std::true_type
+{
+    using encoding = Encoding;
+
+    [[nodiscard]] static constexpr literal_sequence<Encoding>
+    to_sequence(literal_char<Encoding, unused_type> const& p)
+    {
+        using char_type = typename Encoding::char_type;
+        return literal_sequence<Encoding>(static_cast<char_type>(p.classify_ch()));
+    }
+};
+
+template<class Encoding>
+struct optimize_literal<literal_string<std::basic_string_view<typename Encoding::char_type>, Encoding, unused_type>> : std::true_type
+{
+    using encoding = Encoding;
+
+    [[nodiscard]] static constexpr literal_sequence<Encoding>
+    to_sequence(literal_string<std::basic_string_view<typename Encoding::char_type>, Encoding, unused_type> const& p)
+    {
+        return literal_sequence<Encoding>(p.str);
+    }
+};
+
+template<class Encoding, std::size_t N>
+struct optimize_literal<literal_sequence<Encoding, N>> : std::true_type
+{
+    using encoding = Encoding;
+
+    [[nodiscard]] static constexpr literal_sequence<Encoding, N>
+    to_sequence(literal_sequence<Encoding, N> const& p)
+    {
+        return p;
+    }
+};
+
+template<class L, class R>
+constexpr bool optimize_fusable_v = false;
+
+template<class L, class R>
+    requires optimize_literal<L>::value && optimize_literal<R>::value
+constexpr bool optimize_fusable_v<L, R> = std::is_same_v<
+    typename optimize_literal<L>::encoding,
+    typename optimize_literal<R>::encoding
+>;
+
+// Attribute-less char parsers which can be merged into a `char_set`. Note that
+// `char_range` is excluded; its behavior under `no_case` differs from a set.
+
+template<class P>
+struct optimize_char : std::false_type {};
+
+template<class Encoding>
+struct optimize_char<literal_char<Encoding, unused_type>> : std::true_type
+{
+    using encoding = Encoding;
+
+    static constexpr void add_to(basic_chset<typename Encoding::char_type>& chset, literal_char<Encoding, unused_type> const& p)
+    {
+        chset.set(static_cast<typename Encoding::char_type>(p.classify_ch()));
+    }
+};
+
+template<class Encoding>
+struct optimize_char<char_set<Encoding, unused_type>> : std::true_type
+{
+    using encoding = Encoding;
+
+    static constexpr void add_to(basic_chset<typename Encoding::char_type>& chset, char_set<Encoding, unused_type> const& p)
+    {
+        chset |= p.chset;
+    }
+};
+
+template<class L, class R>
+constexpr bool optimize_mergeable_v = false;
+
+template<class L, class R>
+    requires optimize_char<L>::value && optimize_char<R>::value
+constexpr bool optimize_mergeable_v<L, R> = std::is_same_v<
+    typename optimize_char<L>::encoding,
+    typename optimize_char<R>::encoding
+>;
+
+// Parsers which start with a fusable literal: the literal itself, or a
+// sequence whose leftmost element is one
+
+template<class P>
+struct optimize_leading_literal : optimize_literal<P> {};
+
+template<class L, class R>
+struct optimize_leading_literal<sequence<L, R>> : optimize_leading_literal<L> {};
+
+// Alternatives all of whose branches start with a fusable literal
+template<class P>
+struct optimize_factorable : optimize_leading_literal<P> {};
+
+template<class L, class R>
+struct optimize_factorable<alternative<L, R>> : std::false_type {};
+
+template<class L, class R>
+    requires optimize_factorable<L>::value && optimize_factorable<R>::value && std::is_same_v<
+        typename optimize_factorable<L>::encoding,
+        typename optimize_factorable<R>::encoding
+    >
+struct optimize_factorable<alternative<L, R>> : std::true_type
+{
+    using encoding = typename optimize_factorable<L>::encoding;
+};
+
+template<class L, class R>
+constexpr bool optimize_factorable_v = optimize_factorable<alternative<L, R>>::value;
+
+template<class P> constexpr bool optimize_is_sequence_v = false;
+template<class L, class R> constexpr bool optimize_is_sequence_v<sequence<L, R>> = true;
+
+template<class P> constexpr bool optimize_is_alternative_v = false;
+template<class L, class R> constexpr bool optimize_is_alternative_v<alternative<L, R>> = true;
+
+template<class P> constexpr bool optimize_is_omit_v = false;
+template<class S> constexpr bool optimize_is_omit_v<omit_directive<S>> = true;
+
+template<class P> constexpr bool optimize_is_skip_removing_v = false;
+template<class S> constexpr bool optimize_is_skip_removing_v<lexeme_directive<S>> = true;
+template<class S> constexpr bool optimize_is_skip_removing_v<no_skip_directive<S>> = true;
+
+// Reconstruction of `D<Subject>` and `B<Left, Right>` with optimized operands.
+// This is only done for the operators and directives listed below, which are
+// fully described by their operands; any other parser (e.g. `dfa`, whose
+// constructor compiles its subject) is left as written.
+
+template<template<class> class D>
+struct optimize_unary_rebind : std::true_type
+{
+    template<class NewSubject>
+    using rebind = D<NewSubject>;
+};
+
+template<class P> struct optimize_unary : std::false_type {};
+template<class S> struct optimize_unary<kleene<S>> : optimize_unary_rebind<kleene> {};
+template<class S> struct optimize_unary<plus<S>> : optimize_unary_rebind<plus> {};
+template<class S> struct optimize_unary<optional<S>> : optimize_unary_rebind<optional> {};
+template<class S> struct optimize_unary<and_predicate<S>> : optimize_unary_rebind<and_predicate> {};
+template<class S> struct optimize_unary<not_predicate<S>> : optimize_unary_rebind<not_predicate> {};
+template<class S> struct optimize_unary<omit_directive<S>> : optimize_unary_rebind<omit_directive> {};
+template<class S> struct optimize_unary<lexeme_directive<S>> : optimize_unary_rebind<lexeme_directive> {};
+template<class S> struct optimize_unary<no_skip_directive<S>> : optimize_unary_rebind<no_skip_directive> {};
+template<class S> struct optimize_unary<no_case_directive<S>> : optimize_unary_rebind<no_case_directive> {};
+template<class S> struct optimize_unary<raw_directive<S>> : optimize_unary_rebind<raw_directive> {};
+template<class S> struct optimize_unary<matches_directive<S>> : optimize_unary_rebind<matches_directive> {};
+template<class S> struct optimize_unary<expect_directive<S>> : optimize_unary_rebind<expect_directive> {};
+
+template<template<class, class> class B>
+struct optimize_binary_rebind : std::true_type
+{
+    template<class NewLeft, class NewRight>
+    using rebind = B<NewLeft, NewRight>;
+};
+
+template<class P> struct optimize_binary : std::false_type {};
+template<class L, class R> struct optimize_binary<list<L, R>> : optimize_binary_rebind<list> {};
+template<class L, class R> struct optimize_binary<difference<L, R>> : optimize_binary_rebind<difference> {};
+
+// Replaces the leading literal of `p` with an equivalent `literal_sequence`
+template<class P>
+[[nodiscard]] constexpr auto optimize_with_leading_sequence(P const& p)
+{
+    if constexpr (optimize_literal<P>::value) {
+        return optimize_literal<P>::to_sequence(p);
+    } else {
+        using left_type = decltype(detail::optimize_with_leading_sequence(p.left));
+        return sequence<left_type, typename P::right_type>(detail::optimize_with_leading_sequence(p.left), p.right);
+    }
+}
+
+template<class P>
+[[nodiscard]] constexpr auto& optimize_leading_sequence(P& p) noexcept
+{
+    if constexpr (optimize_literal<std::remove_const_t<P>>::value) {
+        return p;
+    } else {
+        return detail::optimize_leading_sequence(p.left);
+    }
+}
+
+template<class Left, class Right>
+[[nodiscard]] constexpr auto optimize_fuse(Left const& left, Right const& right)
+{
+    return optimize_literal<Left>::to_sequence(left).append(optimize_literal<Right>::to_sequence(right));
+}
+
+template<class Left, class Right>
+[[nodiscard]] constexpr auto optimize_merge(Left const& left, Right const& right)
+{
+    using encoding = typename optimize_char<Left>::encoding;
+    using char_type = typename encoding::char_type;
+
+    char_set<encoding, unused_type> merged{std::basic_string_view<char_type>{}};
+    optimize_char<Left>::add_to(merged.chset, left);
+    optimize_char<Right>::add_to(merged.chset, right);
+    return merged;
+}
+
+// Applies `optimize_with_leading_sequence` to each branch of an alternative
+template<class P>
+[[nodiscard]] constexpr auto optimize_with_leading_sequences(P const& p)
+{
+    if constexpr (optimize_is_alternative_v<P>) {
+        auto left = detail::optimize_with_leading_sequences(p.left);
+        auto right = detail::optimize_with_leading_sequences(p.right);
+        return alternative<decltype(left), decltype(right)>(std::move(left), std::move(right));
+    } else {
+        return detail::optimize_with_leading_sequence(p);
+    }
+}
+
+template<class P>
+[[nodiscard]] constexpr auto& optimize_first_branch(P& p) noexcept
+{
+    if constexpr (optimize_is_alternative_v<std::remove_const_t<P>>) {
+        return detail::optimize_first_branch(p.left);
+    } else {
+        return p;
+    }
+}
+
+// The length of the prefix which `first` has in common with every branch
+template<class P, class LiteralSequence>
+[[nodiscard]] constexpr std::size_t optimize_common_prefix_length(P const& p, LiteralSequence const& first) noexcept
+{
+    if constexpr (optimize_is_alternative_v<P>) {
+        return (std::min)(
+            detail::optimize_common_prefix_length(p.left, first),
+            detail::optimize_common_prefix_length(p.right, first)
+        );
+    } else {
+        return first.common_prefix_length(detail::optimize_leading_sequence(p));
+    }
+}
+
+template<class P>
+constexpr void optimize_remove_prefix(P& p, std::size_t const n) noexcept
+{
+    if constexpr (optimize_is_alternative_v<P>) {
+        detail::optimize_remove_prefix(p.left, n);
+        detail::optimize_remove_prefix(p.right, n);
+    } else {
+        (void)detail::optimize_leading_sequence(p).extract_prefix(n);
+    }
+}
+
+// `a >> rest_a | a >> rest_b | ...` => `a >> (rest_a | rest_b | ...)`, where
+// `a` is the longest literal prefix common to all branches. The alternative
+// keeps its shape, so its attribute is unchanged. The common prefix is only
+// known at runtime (the literals are runtime values), so the type of the
+// result does not depend on whether anything could be factored out; an empty
+// prefix trivially matches.
+template<class Alternative>
+[[nodiscard]] constexpr auto optimize_factor(Alternative const& alt)
+{
+    using encoding = typename optimize_factorable<Alternative>::encoding;
+
+    auto rest = detail::optimize_with_leading_sequences(alt);
+    auto first = detail::optimize_leading_sequence(detail::optimize_first_branch(rest));
+    std::size_t const n = detail::optimize_common_prefix_length(rest, first);
+    detail::optimize_remove_prefix(rest, n);
+
+    return sequence<literal_sequence<encoding>, decltype(rest)>(first.extract_prefix(n), std::move(rest));
+}
+
+template<class Left, class Right>
+[[nodiscard]] constexpr auto optimize_sequence(Left const& left, Right const& right)
+{
+    if constexpr (optimize_fusable_v<Left, Right>) {
+        return detail::optimize_fuse(left, right);
+
+    } else if constexpr (optimize_is_sequence_v<Left>) {
+        if constexpr (optimize_fusable_v<typename Left::right_type, Right>) {
+            // (x >> 'a') >> 'b' => x >> "ab"
+            auto fused = detail::optimize_fuse(left.right, right);
+            return sequence<typename Left::left_type, decltype(fused)>(left.left, std::move(fused));
+        } else {
+            return sequence<Left, Right>(left, right);
+        }
+
+    } else if constexpr (optimize_is_sequence_v<Right>) {
+        if constexpr (optimize_fusable_v<Left, typename Right::left_type>) {
+            // 'a' >> ('b' >> x) => "ab" >> x
+            auto fused = detail::optimize_fuse(left, right.left);
+            return sequence<decltype(fused), typename Right::right_type>(std::move(fused), right.right);
+        } else {
+            return sequence<Left, Right>(left, right);
+        }
+
+    } else {
+        return sequence<Left, Right>(left, right);
+    }
+}
+
+// The variant attribute of an alternative flattens nested alternatives, so an
+// alternative which exposes an attribute is only restructured when it is not
+// itself an operand of another alternative. Factoring then applies to all of
+// its branches at once; a prefix shared by only some of them (as in
+// `x | "ab" >> y | "ac" >> z`) is not factored out, as that would nest the
+// variant.
+template<bool InAlternative, class Left, class Right>
+[[nodiscard]] constexpr auto optimize_alternative(Left const& left, Right const& right)
+{
+    if constexpr (optimize_mergeable_v<Left, Right>) {
+        return detail::optimize_merge(left, right);
+
+    } else if constexpr (optimize_factorable_v<Left, Right> && (!InAlternative || !has_attribute_v<alternative<Left, Right>>)) {
+        return detail::optimize_factor(alternative<Left, Right>(left, right));
+
+    } else if constexpr (optimize_is_alternative_v<Left>) {
+        using ll_type = typename Left::left_type;
+        using lr_type = typename Left::right_type;
+
+        if constexpr (optimize_mergeable_v<lr_type, Right>) {
+            // (x | 'a') | 'b' => x | char_set("ab")
+            auto merged = detail::optimize_merge(left.right, right);
+            return alternative<ll_type, decltype(merged)>(left.left, std::move(merged));
+
+        } else if constexpr (optimize_factorable_v<lr_type, Right> && !has_attribute_v<alternative<lr_type, Right>>) {
+            // (x | "ab" >> y) | "ac" >> z => x | "a" >> ("b" >> y | "c" >> z)
+            auto factored = detail::optimize_factor(alternative<lr_type, Right>(left.right, right));
+            return alternative<ll_type, decltype(factored)>(left.left, std::move(factored));
+
+        } else {
+            return alternative<Left, Right>(left, right);
+        }
+
+    } else {
+        return alternative<Left, Right>(left, right);
+    }
+}
+
+template<bool InAlternative, class P>
+[[nodiscard]] constexpr auto optimize_parser(P const& p)
+{
+    if constexpr (optimize_is_sequence_v<P>) {
+        return detail::optimize_sequence(
+            detail::optimize_parser<false>(p.left),
+            detail::optimize_parser<false>(p.right)
+        );
+
+    } else if constexpr (optimize_is_alternative_v<P>) {
+        return detail::optimize_alternative<InAlternative>(
+            detail::optimize_parser<true>(p.left),
+            detail::optimize_parser<true>(p.right)
+        );
+
+    } else if constexpr (optimize_is_omit_v<P>) {
+        auto subject = detail::optimize_parser<false>(p.subject);
+        using subject_type = decltype(subject);
+
+        if constexpr (!has_attribute_v<subject_type>) {
+            // omit[p] => p, where p has no attribute
+            return subject;
+        } else if constexpr (optimize_is_omit_v<subject_type>) {
+            // omit[omit[p]] => omit[p]
+            return subject;
+        } else {
+            return omit_directive<subject_type>{std::move(subject)};
+        }
+
+    } else if constexpr (optimize_is_skip_removing_v<P>) {
+        // The subject of `lexeme` or `no_skip` runs without a skipper, so a
+        // nested `lexeme` or `no_skip` is a no-op:
+        //   lexeme[lexeme[p]] => lexeme[p],   lexeme[no_skip[p]] => lexeme[p]
+        //   no_skip[no_skip[p]] => no_skip[p], no_skip[lexeme[p]] => no_skip[p]
+        auto subject = detail::optimize_parser<false>(p.subject);
+        using subject_type = decltype(subject);
+        using rebind = optimize_unary<P>;
+
+        if constexpr (optimize_is_skip_removing_v<subject_type>) {
+            return typename rebind::template rebind<typename subject_type::subject_type>{std::move(subject.subject)};
+        } else {
+            return typename rebind::template rebind<subject_type>{std::move(subject)};
+        }
+
+    } else if constexpr (optimize_unary<P>::value) {
+        auto subject = detail::optimize_parser<false>(p.subject);
+        return typename optimize_unary<P>::template rebind<decltype(subject)>{std::move(subject)};
+
+    } else if constexpr (optimize_binary<P>::value) {
+        auto left = detail::optimize_parser<false>(p.left);
+        auto right = detail::optimize_parser<false>(p.right);
+        return typename optimize_binary<P>::template rebind<decltype(left), decltype(right)>(std::move(left), std::move(right));
+
+    } else {
+        // Leaves and parsers with additional state (actions, rules, `dfa`,
+        // `repeat`, `skip`, ...) are left as written
+        return p;
+    }
+}
+
+struct optimize_fn
+{
+    template<X4Subject Subject>
+    [[nodiscard]] static constexpr auto operator()(Subject&& subject)
+    {
+        return detail::optimize_parser<false>(as_parser(std::forward<Subject>(subject)));
+    }
+};
+
+} // detail
+
+// `x4::optimize(p)` returns a parser equivalent to `p`, rewritten to do less
+// work at parse time:
+//
+//   - adjacent attribute-less literals are fused into a single
+//     `literal_sequence`:                 'a' >> 'b' >> 'c' => "abc"
+//   - alternatives of attribute-less chars are merged into a set:
+//                                         'a' | 'b' | 'c'   => char_set("abc")
+//   - common literal prefixes are factored out of alternatives, so that the
+//     prefix is not re-matched after backtracking:
+//         lit("select") >> x | lit("set") >> y => "se" >> ("lect" >> x | "t" >> y)
+//     An alternative with an attribute is only factored when the prefix is
+//     common to all of its branches, since factoring a subset of them would
+//     change the shape of its variant attribute.
+//   - nested `omit`, `lexeme` and `no_skip` directives are collapsed, and
+//     `omit` is dropped around parsers without an attribute.
+//
+// The attribute of the result, and the attribute of each of its operands, are
+// the same as those of `p`; pre-skipping and backtracking behave as before.
+// The rewriting of an alternative depends on its position, so apply this to a
+// complete grammar (or rule definition) rather than to a fragment which is
+// subsequently combined with `|`.
+//
+// Only the built-in operators and stateless directives are looked into;
+// actions, rules and directives with additional state are left as written.
+// Fused literals refer to the characters of the original string literals, and
+// string literals owning their characters (e.g. `lit(std::string(...))`) are
+// not fused.
+inline namespace cpos {
+
+[[maybe_unused]] inline constexpr detail::optimize_fn optimize{};
+
+} // cpos
+
+} // iris::x4
+
+#endif
@@ -158,25 +158,76 @@ concept X4RangeParseSkipper =
         typename range_parse_parser_impl<R>::sentinel_type
     >;
 
-struct parse_fn_main
+// Treat "str" as `string_view`
+template<std::ranges::forward_range R>
+    requires (!traits::CharArray<R>)
+[[nodiscard]] constexpr decltype(auto) as_parse_range(R const& range) noexcept
 {
-private:
-    template<std::ranges::forward_range R>
-        requires (!traits::CharArray<R>)
-    [[nodiscard]] static constexpr decltype(auto) as_parse_range(R const& range) noexcept
-    {
-        return range;
-    }
+    return range;
+}
 
-    template<std::ranges::forward_range R>
-        requires traits::CharArray<R>
-    [[nodiscard]] static constexpr auto as_parse_range(R const& str)
-        noexcept(noexcept(std::basic_string_view{str}))
-    {
-        return std::basic_string_view{str};
+template<std::ranges::forward_range R>
+    requires traits::CharArray<R>
+[[nodiscard]] constexpr auto as_parse_range(R const& str)
+    noexcept(noexcept(std::basic_string_view{str}))
+{
+    return std::basic_string_view{str};
+}
+
+// The common implementation of the entry points which bind one more context
+// on top of those bound by `phrase_parse(...)`, i.e. `validate(...)`,
+// `parse_two_phase(...)` and `parse_recovering(...)`. Parses `attr` with
+// `extra` bound to `ExtraID`, then post-skips if `post_skip` is set.
+template<class ExtraID, std::forward_iterator It, std::sentinel_for<It> Se, class Parser, class Skipper, X4Attribute ParseAttr, class Extra>
+[[nodiscard]] constexpr bool
+parse_with_extra_context(
+    It& first, Se const& last, Parser const& p, Skipper& skipper, ParseAttr& attr, bool const post_skip,
+    expectation_failure<It>& expect_failure, Extra& extra
+)
+{
+    auto const ctx = x4::make_context<ExtraID>(
+        extra,
+        x4::make_context<contexts::expectation_failure>(
+            expect_failure, x4::make_context<contexts::skipper>(skipper)
+        )
+    );
+
+    bool ok = p.parse(first, last, ctx, attr);
+    if (ok && post_skip) {
+        x4::skip_over(first, last, ctx);
+        if (expect_failure) [[unlikely]] ok = false;
+    }
+    return ok;
+}
+
+// Same as above, with `extra2` bound to `ExtraID2` as well
+template<class ExtraID, class ExtraID2, std::forward_iterator It, std::sentinel_for<It> Se, class Parser, class Skipper, X4Attribute ParseAttr, class Extra, class Extra2>
+[[nodiscard]] constexpr bool
+parse_with_extra_context(
+    It& first, Se const& last, Parser const& p, Skipper& skipper, ParseAttr& attr, bool const post_skip,
+    expectation_failure<It>& expect_failure, Extra& extra, Extra2& extra2
+)
+{
+    auto const ctx = x4::make_context<ExtraID2>(
+        extra2,
+        x4::make_context<ExtraID>(
+            extra,
+            x4::make_context<contexts::expectation_failure>(
+                expect_failure, x4::make_context<contexts::skipper>(skipper)
+            )
+        )
+    );
+
+    bool ok = p.parse(first, last, ctx, attr);
+    if (ok && post_skip) {
+        x4::skip_over(first, last, ctx);
+        if (expect_failure) [[unlikely]] ok = false;
     }
+    return ok;
+}
 
-public:
+struct parse_fn_main
+{
     // --------------------------------------------
     // parse(range)
 
@@ -186,7 +237,7 @@ public:
     operator()(R const& range, Parser&& p, ParseAttr& attr)
     {
         // Treat "str" as `string_view`
-        auto const& range_ = parse_fn_main::as_parse_range(range);
+        auto const& range_ = detail::as_parse_range(range);
 
         using It = typename parse_result_for<R>::iterator_type;
         using Se = typename parse_result_for<R>::sentinel_type;
@@ -217,7 +268,7 @@ public:
     operator()(parse_result_for<R>& res, R const& range, Parser&& p, ParseAttr& attr)
     {
         // Treat "str" as `string_view`
-        auto const& range_ = parse_fn_main::as_parse_range(range);
+        auto const& range_ = detail::as_parse_range(range);
 
         using It = typename parse_result_for<R>::iterator_type;
         using Se = typename parse_result_for<R>::sentinel_type;
@@ -247,7 +298,7 @@ public:
     operator()(R const& range, Parser&& p, Skipper const& s, ParseAttr& attr, root_skipper_flag flag = root_skipper_flag::do_post_skip)
     {
         // Treat "str" as `string_view`
-        auto const& range_ = parse_fn_main::as_parse_range(range);
+        auto const& range_ = detail::as_parse_range(range);
 
         using It = typename parse_result_for<R>::iterator_type;
         using Se = typename parse_result_for<R>::sentinel_type;
@@ -280,7 +331,7 @@ public:
     operator()(parse_result_for<R>& res, R const& range, Parser&& p, Skipper const& s, ParseAttr& attr, root_skipper_flag flag = root_skipper_flag::do_post_skip)
     {
         // Treat "str" as `string_view`
-        auto const& range_ = parse_fn_main::as_parse_range(range);
+        auto const& range_ = detail::as_parse_range(range);
 
         using It = typename parse_result_for<R>::iterator_type;
         using Se = typename parse_result_for<R>::sentinel_type;
@@ -0,0 +1,125 @@
+#ifndef IRIS_X4_PARSE_RECOVERING_HPP
+#define IRIS_X4_PARSE_RECOVERING_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/parse.hpp>
+#include <iris/x4/directive/recover.hpp>
+
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace iris::x4 {
+
+template<std::forward_iterator It, std::sentinel_for<It> Se = It>
+struct [[nodiscard]] recovering_parse_result : parse_result<It, Se>
+{
+    // The failures recovered from by `x4::recover(sync)[p]`, in order of
+    // occurrence. These do not affect `ok`, which only reflects whether
+    // the parse went on to succeed after them.
+    std::vector<expectation_failure<It>> recovered_failures;
+
+    [[nodiscard]] constexpr bool has_failures() const noexcept
+    {
+        return this->expect_failure.has_value() || !recovered_failures.empty();
+    }
+
+    // The recovered failures, followed by the final one if any
+    [[nodiscard]] constexpr std::vector<expectation_failure<It>> all_failures() const
+    {
+        std::vector<expectation_failure<It>> failures = recovered_failures;
+        if (this->expect_failure.has_value()) failures.push_back(this->expect_failure);
+        return failures;
+    }
+};
+
+namespace detail {
+
+struct parse_recovering_fn
+{
+private:
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Parser, class Skipper, X4Attribute ParseAttr>
+    [[nodiscard]] static constexpr recovering_parse_result<It, Se>
+    call(It first, Se last, Parser const& p, Skipper& skipper, ParseAttr& attr, bool const post_skip)
+    {
+        recovering_parse_result<It, Se> res;
+        res.ok = detail::parse_with_extra_context<contexts::recovered_failures>(
+            first, last, p, skipper, attr, post_skip, res.expect_failure, res.recovered_failures
+        );
+        res.remainder = {std::move(first), std::move(last)};
+        return res;
+    }
+
+    template<std::ranges::forward_range R>
+    using result_for = recovering_parse_result<
+        typename parse_result_for<R>::iterator_type,
+        typename parse_result_for<R>::sentinel_type
+    >;
+
+public:
+    // It/Se + Parser + Attribute
+    template<std::forward_iterator It, std::sentinel_for<It> Se, X4Parser<It, Se> Parser, X4Attribute ParseAttr>
+    static constexpr recovering_parse_result<It, Se>
+    operator()(It first, Se last, Parser&& p, ParseAttr& attr)
+    {
+        auto skipper_kind = builtin_skipper_kind::no_skip;
+        return parse_recovering_fn::call(std::move(first), std::move(last), as_parser(std::forward<Parser>(p)), skipper_kind, attr, false);
+    }
+
+    // It/Se + Parser + Skipper + Attribute + (root_skipper_flag)
+    template<std::forward_iterator It, std::sentinel_for<It> Se, X4Parser<It, Se> Parser, X4ExplicitParser<It, Se> Skipper, X4Attribute ParseAttr>
+    static constexpr recovering_parse_result<It, Se>
+    operator()(It first, Se last, Parser&& p, Skipper const& s, ParseAttr& attr, root_skipper_flag flag = root_skipper_flag::do_post_skip)
+    {
+        auto&& maybe_builtin_skipper = to_builtin(s);
+        return parse_recovering_fn::call(
+            std::move(first), std::move(last), as_parser(std::forward<Parser>(p)),
+            maybe_builtin_skipper, attr, flag == root_skipper_flag::do_post_skip
+        );
+    }
+
+    // R + Parser + Attribute
+    template<std::ranges::forward_range R, X4RangeParseParser<R> Parser, X4Attribute ParseAttr>
+    static constexpr result_for<R>
+    operator()(R const& range, Parser&& p, ParseAttr& attr)
+    {
+        // Treat "str" as `string_view`
+        auto const& range_ = detail::as_parse_range(range);
+        return parse_recovering_fn{}(std::ranges::begin(range_), std::ranges::end(range_), std::forward<Parser>(p), attr);
+    }
+
+    // R + Parser + Skipper + Attribute + (root_skipper_flag)
+    template<std::ranges::forward_range R, X4RangeParseParser<R> Parser, X4RangeParseSkipper<R> Skipper, X4Attribute ParseAttr>
+    static constexpr result_for<R>
+    operator()(R const& range, Parser&& p, Skipper const& s, ParseAttr& attr, root_skipper_flag flag = root_skipper_flag::do_post_skip)
+    {
+        // Treat "str" as `string_view`
+        auto const& range_ = detail::as_parse_range(range);
+        return parse_recovering_fn{}(std::ranges::begin(range_), std::ranges::end(range_), std::forward<Parser>(p), s, attr, flag);
+    }
+};
+
+} // detail
+
+inline namespace cpos {
+
+// `parse_recovering(...)` takes the same arguments as `parse(...)`, and also
+// collects every expectation failure recovered from by `x4::recover(sync)[p]`
+// into `recovering_parse_result::recovered_failures`. This reports all the
+// errors of an input in one pass, as long as the grammar marks where to
+// resume after each.
+[[maybe_unused]] inline constexpr detail::parse_recovering_fn parse_recovering{};
+
+} // cpos
+
+} // iris::x4
+
+#endif
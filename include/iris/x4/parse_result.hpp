@@ -33,7 +33,8 @@ struct [[nodiscard]] parse_result
     // Represents the failure of `x4::expect[p]` and `a > b`.
     // Has value if and only if `ok` is `false` and any of
     // the underlying parsers have encountered expectation
-    // failure.
+    // failure, or the parse was stopped by an exhausted
+    // `x4::parse_budget`.
     expectation_failure<It> expect_failure;
 
     // Represents the remaining subrange of the input, after
@@ -0,0 +1,126 @@
+#ifndef IRIS_X4_PARSE_TWO_PHASE_HPP
+#define IRIS_X4_PARSE_TWO_PHASE_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/parse.hpp>
+#include <iris/x4/core/decision_log.hpp>
+#include <iris/x4/core/validation.hpp>
+
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace iris::x4 {
+
+namespace detail {
+
+struct parse_two_phase_fn
+{
+private:
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Parser, class Skipper, X4Attribute ParseAttr>
+    [[nodiscard]] static constexpr parse_result<It, Se>
+    call(It first, Se last, Parser const& p, Skipper& skipper, ParseAttr& attr, bool const post_skip)
+    {
+        decision_log log;
+        bool validating = true;
+        expectation_failure<It> expect_failure;
+
+        // Phase 1: recognize, as `x4::validate` does
+        It it = first;
+        if (!detail::parse_with_extra_context<contexts::decision_log, contexts::validation>(
+            it, last, p, skipper, unused, post_skip, expect_failure, log, validating
+        )) {
+            return parse_result<It, Se>{
+                .ok = false,
+                .expect_failure = std::move(expect_failure),
+                .remainder = {std::move(it), std::move(last)}
+            };
+        }
+
+        // Phase 2: build the attribute along the recorded path
+        log.replay();
+        bool const ok = detail::parse_with_extra_context<contexts::decision_log>(
+            first, last, p, skipper, attr, post_skip, expect_failure, log
+        );
+        return parse_result<It, Se>{
+            .ok = ok,
+            .expect_failure = std::move(expect_failure),
+            .remainder = {std::move(first), std::move(last)}
+        };
+    }
+
+public:
+    // It/Se + Parser + Attribute
+    template<std::forward_iterator It, std::sentinel_for<It> Se, X4Parser<It, Se> Parser, X4Attribute ParseAttr>
+    static constexpr parse_result<It, Se>
+    operator()(It first, Se last, Parser&& p, ParseAttr& attr)
+    {
+        auto skipper_kind = builtin_skipper_kind::no_skip;
+        return parse_two_phase_fn::call(std::move(first), std::move(last), as_parser(std::forward<Parser>(p)), skipper_kind, attr, false);
+    }
+
+    // It/Se + Parser + Skipper + Attribute + (root_skipper_flag)
+    template<std::forward_iterator It, std::sentinel_for<It> Se, X4Parser<It, Se> Parser, X4ExplicitParser<It, Se> Skipper, X4Attribute ParseAttr>
+    static constexpr parse_result<It, Se>
+    operator()(It first, Se last, Parser&& p, Skipper const& s, ParseAttr& attr, root_skipper_flag flag = root_skipper_flag::do_post_skip)
+    {
+        auto&& maybe_builtin_skipper = to_builtin(s);
+        return parse_two_phase_fn::call(
+            std::move(first), std::move(last), as_parser(std::forward<Parser>(p)),
+            maybe_builtin_skipper, attr, flag == root_skipper_flag::do_post_skip
+        );
+    }
+
+    // R + Parser + Attribute
+    template<std::ranges::forward_range R, X4RangeParseParser<R> Parser, X4Attribute ParseAttr>
+    static constexpr parse_result_for<R>
+    operator()(R const& range, Parser&& p, ParseAttr& attr)
+    {
+        // Treat "str" as `string_view`
+        auto const& range_ = detail::as_parse_range(range);
+        return parse_two_phase_fn{}(std::ranges::begin(range_), std::ranges::end(range_), std::forward<Parser>(p), attr);
+    }
+
+    // R + Parser + Skipper + Attribute + (root_skipper_flag)
+    template<std::ranges::forward_range R, X4RangeParseParser<R> Parser, X4RangeParseSkipper<R> Skipper, X4Attribute ParseAttr>
+    static constexpr parse_result_for<R>
+    operator()(R const& range, Parser&& p, Skipper const& s, ParseAttr& attr, root_skipper_flag flag = root_skipper_flag::do_post_skip)
+    {
+        // Treat "str" as `string_view`
+        auto const& range_ = detail::as_parse_range(range);
+        return parse_two_phase_fn{}(std::ranges::begin(range_), std::ranges::end(range_), std::forward<Parser>(p), s, attr, flag);
+    }
+};
+
+} // detail
+
+inline namespace cpos {
+
+// `parse_two_phase(...)` takes the same arguments as `parse(...)` and gives
+// the same result, but runs the parser twice. The first run recognizes the
+// input as `validate(...)` does (see `x4::contexts::validation`), i.e. rules
+// construct no attribute, and records the branch taken by each `alternative`
+// in an `x4::decision_log`. If it succeeds, the second run builds the
+// attribute by taking only the recorded branches, so that no attribute is
+// built for a branch which eventually fails and nothing has to be rolled
+// back. A failed parse builds no attribute at all.
+//
+// Semantic actions are invoked by the second run only, once along the
+// recorded path. An action which rejects some inputs must therefore be
+// wrapped in `x4::required(...)`, so that the first run sees the rejection;
+// such an action is invoked by both runs. This pays off for grammars whose
+// alternatives fail late after building large attributes.
+[[maybe_unused]] inline constexpr detail::parse_two_phase_fn parse_two_phase{};
+
+} // cpos
+
+} // iris::x4
+
+#endif
@@ -19,6 +19,9 @@
 #include <iris/x4/core/expectation.hpp>
 #include <iris/x4/core/context.hpp>
 #include <iris/x4/core/action_context.hpp>
+#include <iris/x4/core/parse_budget.hpp>
+#include <iris/x4/core/rule_instrumentation.hpp>
+#include <iris/x4/core/validation.hpp>
 #include <iris/x4/core/container_appender.hpp>
 
 #include <iris/x4/traits/transform_attribute.hpp>
@@ -29,7 +32,9 @@
 
 #include <string_view>
 #include <concepts>
+#include <cstddef>
 #include <iterator>
+#include <ranges>
 #include <type_traits>
 #include <utility>
 
@@ -40,6 +45,18 @@ namespace iris::x4 {
 template<class RuleID, X4Attribute Attr = unused_type, bool ForceAttribute = false>
 struct rule;
 
+template<class Subject>
+struct kleene;
+
+template<class Subject>
+struct plus;
+
+template<class Left, class Right>
+struct list;
+
+template<class Left, class Right>
+struct sequence;
+
 namespace detail {
 
 template<class RuleID>
@@ -233,6 +250,18 @@ private:
         }
     }
 
+    template<class Transform, class Context, X4Attribute Exposed>
+    [[nodiscard]] static constexpr decltype(auto)
+    pre_transform(Exposed& exposed_attr)
+    {
+        if constexpr (is_validating_v<Context>) {
+            (void)exposed_attr;
+            return unused_type{};
+        } else {
+            return Transform::pre(exposed_attr);
+        }
+    }
+
 public:
     template<
         bool ForceAttr,
@@ -246,10 +275,16 @@ public:
         Context const& ctx, Exposed& exposed_attr
     )
     {
-        // Do down-stream transformation, provide attribute for `rhs` parser
+        // Fails without parsing once the budget bound to `contexts::budget` is exhausted
+        scoped_budget_rule<Context, It> budget_rule{ctx, first};
+        if (!budget_rule.ok()) return false;
+
+        // Do down-stream transformation, provide attribute for `rhs` parser.
+        // When validating, no attribute is constructed and `exposed_attr` is
+        // not accessed.
         using transform = traits::transform_attribute<Attr, Exposed>;
-        using transform_attr = typename transform::type;
-        transform_attr rhs_attr = transform::pre(exposed_attr);
+        using transform_attr = std::conditional_t<is_validating_v<Context>, unused_type, typename transform::type>;
+        transform_attr rhs_attr = rule_impl::pre_transform<transform, Context>(exposed_attr);
 
         // Creates a place to hold the result of parse_rhs
         // called inside the following scope.
@@ -262,13 +297,31 @@ public:
             [[maybe_unused]] scoped_tracer<RuleID, It, Se, Context, std::remove_reference_t<transform_attr>>
             scoped_tracer{first, last, ctx, rhs_attr, rule_name, &parse_ok};
 
+            // Each of these is a no-op unless its context is bound
+            [[maybe_unused]] scoped_rule_profiler<RuleID, Context, It>
+            scoped_profiler{ctx, rule_name, first, &parse_ok};
+            [[maybe_unused]] scoped_heatmap_rule<Context, It>
+            scoped_heatmap{ctx, rule_name, first};
+            [[maybe_unused]] scoped_flight_recording<RuleID, Context, It>
+            scoped_recording{ctx, rule_name, first, &parse_ok};
+            [[maybe_unused]] scoped_allocation_rule<Context>
+            scoped_allocations{ctx, rule_name};
+
             // The existence of semantic action inhibits attribute materialization _unless_ it is
             // explicitly required by the user (primarily via `%=`).
             //
             // Note: `x4::as<T>(...)` explicitly unsets `has_action` even if the underlying subject
             // has semantic action, so it will be dispatched to the latter branch (unless the
             // `as_directive` itself has semantic action).
-            if constexpr (RHS::has_action) {
+            if constexpr (is_validating_v<Context>) {
+                // Recognize only; `_val` is `unused`
+                parse_ok = rule_impl::parse_rhs(
+                    rhs, first, last,
+                    x4::replace_first_context<contexts::rule_var>(ctx, rhs_attr),
+                    unused
+                );
+
+            } else if constexpr (RHS::has_action) {
                 if constexpr (ForceAttr) {
                     parse_ok = rule_impl::parse_rhs(
                         rhs, first, last,
@@ -292,14 +345,104 @@ public:
             }
         }
 
-        if (parse_ok) {
-            // Integrate the results back into the original attribute value, if appropriate
-            transform::post(exposed_attr, std::forward<transform_attr>(rhs_attr));
+        if constexpr (!is_validating_v<Context>) {
+            if (parse_ok) {
+                // Integrate the results back into the original attribute value, if appropriate
+                transform::post(exposed_attr, std::forward<transform_attr>(rhs_attr));
+            }
         }
         return parse_ok;
     }
 };
 
+// Parsers which only insert into a `container_appender` passed to them, so
+// that the elements they added can be removed again by truncating the
+// container to its previous size. Other parsers may assign or clear the
+// whole container (e.g. `alternative`, `attr`).
+template<class P>
+struct appends_only : std::false_type {};
+
+// An element parsed into a value which is then inserted, or itself only
+// inserting. Semantic actions are excluded, since an action accessing
+// `_rule_var` would see the elements which precede those of the rule.
+template<class P>
+constexpr bool appends_element_v = !P::has_action && (!P::handles_container || appends_only<P>::value);
+
+template<class Subject>
+struct appends_only<kleene<Subject>> : std::bool_constant<appends_element_v<Subject>> {};
+
+template<class Subject>
+struct appends_only<plus<Subject>> : std::bool_constant<appends_element_v<Subject>> {};
+
+template<class Left, class Right>
+struct appends_only<list<Left, Right>> : std::bool_constant<appends_element_v<Left> && appends_element_v<Right>> {};
+
+template<class Left, class Right>
+struct appends_only<sequence<Left, Right>> : std::bool_constant<appends_element_v<Left> && appends_element_v<Right>> {};
+
+// A rule appends to a `container_appender` (see `parse_rule_into_appender`)
+template<class RuleID, class RuleAttr, bool ForceAttr>
+struct appends_only<rule<RuleID, RuleAttr, ForceAttr>> : std::true_type {};
+
+// The definition of a rule is only known to `rule::parse` when it is parsed
+// through the default `parse_rule`, i.e. bound to `RuleID` in the context.
+// With `IRIS_X4_DEFINE`, it is not known and assumed not to only append.
+template<class RuleID, class Context>
+constexpr bool rule_appends_only_v = false;
+
+template<class RuleID, class Context>
+    requires has_context_v<Context, RuleID>
+constexpr bool rule_appends_only_v<RuleID, Context> = appends_only<
+    std::remove_cvref_t<decltype(x4::get<RuleID>(std::declval<Context const&>()))>
+>::value;
+
+template<class Container>
+concept TruncatableContainer =
+    !traits::is_associative_v<Container> &&
+    requires(Container& c) {
+        { std::ranges::size(c) } -> std::convertible_to<std::size_t>;
+        c.erase(std::ranges::next(std::ranges::begin(c), 0), std::ranges::end(c));
+    };
+
+// Parses a rule whose attribute is `RuleAttr` into the caller's container
+// through `parse(RuleAttr&)`, which parses the rule definition:
+//   - if the definition only appends (`AppendsOnly`), it parses straight
+//     into the container, which is truncated to its previous size on failure;
+//   - otherwise it parses straight into the container only while the
+//     container is empty (i.e. in its monostate, see `alternative`), and
+//     into a temporary which is then appended otherwise.
+template<bool AppendsOnly, class RuleAttr, class Context, class Parse>
+[[nodiscard]] constexpr bool
+parse_rule_into_appender(container_appender<RuleAttr>& appender, Context const& ctx, Parse const& parse)
+{
+    RuleAttr& container = appender.container;
+
+    if constexpr (AppendsOnly && TruncatableContainer<RuleAttr>) {
+        auto const mark = static_cast<std::size_t>(std::ranges::size(container));
+        if (parse(container)) return true;
+        container.erase(std::ranges::next(std::ranges::begin(container), static_cast<std::ptrdiff_t>(mark)), std::ranges::end(container));
+        return false;
+
+    } else {
+        if (traits::is_empty(container)) {
+            if (parse(container)) return true;
+            traits::clear(container);
+            return false;
+        }
+
+        RuleAttr rule_attr;
+        if (!parse(rule_attr)) return false;
+
+        [[maybe_unused]] scoped_container_growth<Context, RuleAttr> growth{ctx, container};
+        traits::append(
+            container,
+            std::make_move_iterator(traits::begin(rule_attr)),
+            std::make_move_iterator(traits::end(rule_attr))
+        );
+        return true;
+    }
+}
+
 template<class RuleID, X4Subject RHS, X4Attribute RuleDefAttr, bool ForceAttr, bool SkipDefinitionInjection = false>
 struct rule_definition : parser<rule_definition<RuleID, RHS, RuleDefAttr, ForceAttr, SkipDefinitionInjection>>
 {
@@ -328,16 +471,29 @@ struct rule_definition : parser<rule_definition<RuleID, RHS, RuleDefAttr, ForceA
     parse(It& first, Se const& last, Context const& ctx, Attr& attr) const
         // never noexcept; requires very complex implementation details
     {
-        return rule_impl<RuleID, attribute_type, SkipDefinitionInjection>
-            ::template call_rule_definition<ForceAttr>(
-                rhs, name, first, last, ctx, attr
-            );
+        if constexpr (std::same_as<Attr, container_appender<RuleDefAttr>>) {
+            return detail::parse_rule_into_appender<appends_only<RHS>::value>(attr, ctx, [&](RuleDefAttr& storage) {
+                return rule_impl<RuleID, attribute_type, SkipDefinitionInjection>
+                    ::template call_rule_definition<ForceAttr>(
+                        rhs, name, first, last, ctx, storage
+                    );
+            });
+
+        } else {
+            return rule_impl<RuleID, attribute_type, SkipDefinitionInjection>
+                ::template call_rule_definition<ForceAttr>(
+                    rhs, name, first, last, ctx, attr
+                );
+        }
     }
 
     RHS rhs;
     std::string_view name = "unnamed";
 };
 
+template<class RuleID, class RHS, class RuleDefAttr, bool ForceAttr, bool SkipDefinitionInjection>
+struct appends_only<rule_definition<RuleID, RHS, RuleDefAttr, ForceAttr, SkipDefinitionInjection>> : std::true_type {};
+
 template<class Exposed>
 struct narrowing_checker
 {
@@ -441,7 +597,21 @@ struct rule : parser<rule<RuleID, RuleAttr, ForceAttr>>
         } else {
             static_assert(detail::RuleAttrTransformable<Exposed, RuleAttr>);
 
-            // TODO: specialize `container_appender` case, do not create temporary
+            if constexpr (std::same_as<Exposed, container_appender<RuleAttr>>) {
+                return detail::parse_rule_into_appender<detail::rule_appends_only_v<RuleID, Context>>(exposed_attr, ctx, [&](RuleAttr& storage) {
+                    return static_cast<bool>(parse_rule(detail::rule_id<RuleID>{}, first, last, rule_agnostic_ctx, storage));  // NOLINT(bugprone-non-zero-enum-to-bool-conversion)
+                });
+
+            } else if constexpr (!std::is_const_v<Exposed> && traits::TransformableInPlace<RuleAttr, Exposed>) {
+                using in_place = traits::transform_in_place<RuleAttr, Exposed>;
+                if (RuleAttr* const storage = in_place::pre(exposed_attr)) {
+                    if (static_cast<bool>(parse_rule(detail::rule_id<RuleID>{}, first, last, rule_agnostic_ctx, *storage))) {  // NOLINT(bugprone-non-zero-enum-to-bool-conversion)
+                        return true;
+                    }
+                    in_place::rollback(exposed_attr);
+                    return false;
+                }
+            }
 
             RuleAttr rule_attr;
             if (!static_cast<bool>(parse_rule(detail::rule_id<RuleID>{}, first, last, rule_agnostic_ctx, rule_attr))) {  // NOLINT(bugprone-non-zero-enum-to-bool-conversion)
@@ -449,6 +619,8 @@ struct rule : parser<rule<RuleID, RuleAttr, ForceAttr>>
             }
 
             if constexpr (is_ttp_specialization_of_v<std::remove_const_t<Exposed>, container_appender>) {
+                [[maybe_unused]] detail::scoped_container_growth<Context, std::remove_reference_t<decltype(exposed_attr.container)>>
+                growth{ctx, exposed_attr.container};
                 traits::append(
                     exposed_attr.container,
                     std::make_move_iterator(traits::begin(rule_attr)),
@@ -477,14 +649,22 @@ struct rule : parser<rule<RuleID, RuleAttr, ForceAttr>>
     parse(It& first, Se const& last, Context const& ctx, unused_type const&) const
         // never noexcept; requires very complex implementation details
     {
-        // make sure we pass exactly the rule attribute type
-        attribute_type no_attr; // default-initialize
-
         // See the comments on the primary overload of `rule::parse(...)`
         auto&& rule_agnostic_ctx = x4::remove_first_context<contexts::rule_var>(ctx);
 
         using detail::parse_rule; // ADL
-        return static_cast<bool>(parse_rule(detail::rule_id<RuleID>{}, first, last, rule_agnostic_ctx, no_attr));  // NOLINT(bugprone-non-zero-enum-to-bool-conversion)
+
+        if constexpr (is_validating_v<Context>) {
+            // The rule definition does not access its attribute when validating,
+            // so none is constructed
+            detail::unconstructed_attribute<attribute_type> no_attr;
+            return static_cast<bool>(parse_rule(detail::rule_id<RuleID>{}, first, last, rule_agnostic_ctx, no_attr.value));  // NOLINT(bugprone-non-zero-enum-to-bool-conversion)
+
+        } else {
+            // make sure we pass exactly the rule attribute type
+            attribute_type no_attr; // default-initialize
+            return static_cast<bool>(parse_rule(detail::rule_id<RuleID>{}, first, last, rule_agnostic_ctx, no_attr));  // NOLINT(bugprone-non-zero-enum-to-bool-conversion)
+        }
     }
 
     template<X4Subject RHS>
@@ -553,12 +733,14 @@ namespace detail {
 
 struct rule_get_info
 {
-    using result_type = std::string;
+    using result_type = std::string_view;
 
+    // Expectation failures refer to the name instead of copying it, so a name
+    // built at runtime must outlive them as well as the rule
     template<class RuleT> // `rule` or `rule_definition`
-    [[nodiscard]] static std::string operator()(RuleT const& rule_like)
+    [[nodiscard]] static constexpr std::string_view operator()(RuleT const& rule_like) noexcept
     {
-        return std::string{rule_like.name};
+        return rule_like.name;
     }
 };
 
@@ -0,0 +1,243 @@
+#ifndef IRIS_X4_STRING_AHO_CORASICK_HPP
+#define IRIS_X4_STRING_AHO_CORASICK_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#include <iris/config.hpp>
+
+#include <algorithm>
+#include <bitset>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cassert>
+
+namespace iris::x4 {
+
+// An Aho-Corasick automaton over a set of keys, each associated with a value.
+// `find` locates the leftmost-longest occurrence of any key in a single pass
+// over the input, which is the same match `seek[symbols]` would produce, but
+// without restarting a lookup at every input position.
+//
+// While the automaton is in its root state, the input is skipped with a
+// prefilter on the first characters of all keys (a 256-bit set indexed by the
+// low byte of the character), so that runs of irrelevant input are consumed
+// with a single table lookup per character.
+//
+// Keys are matched case-sensitively.
+template<class Char, class T>
+struct aho_corasick
+{
+    using char_type = Char;
+    using value_type = T;
+
+    template<std::forward_iterator It>
+    struct match
+    {
+        It end;             // one past the last character of the match
+        std::size_t offset; // distance from the start of the search to the match
+        std::size_t length;
+        T const* value;
+    };
+
+    aho_corasick()
+    {
+        states_.emplace_back();
+    }
+
+    // As with `tst::add`, the first value added for a given key wins, and
+    // empty keys are ignored. Invalidates the compiled automaton.
+    void add(std::basic_string_view<Char> const key, T const& val)
+    {
+        if (key.empty()) return;
+        compiled_ = false;
+
+        std::uint32_t s = 0;
+        for (Char const c : key) {
+            auto& trans = states_[s].trans;
+            auto const it = std::ranges::lower_bound(trans, c, {}, &edge::label);
+            if (it != trans.end() && it->label == c) {
+                s = it->target;
+                continue;
+            }
+
+            auto const next = static_cast<std::uint32_t>(states_.size());
+            std::uint32_t const depth = states_[s].depth + 1;
+            trans.insert(it, edge{c, next});
+            states_.emplace_back(); // invalidates `trans`
+            states_.back().depth = depth;
+            s = next;
+        }
+
+        if (states_[s].value == npos) {
+            states_[s].value = static_cast<std::uint32_t>(values_.size());
+            values_.push_back(val);
+        }
+    }
+
+    // Computes the failure links. Must be called after the last `add` and
+    // before the first `find`.
+    void compile()
+    {
+        if (compiled_) return;
+
+        first_chars_.reset();
+        for (auto const& e : states_[0].trans) {
+            first_chars_.set(low_byte(e.label));
+        }
+
+        // Breadth-first, so that the failure target of a state is always
+        // complete before the state itself
+        std::vector<std::uint32_t> queue;
+        queue.reserve(states_.size());
+        for (auto const& e : states_[0].trans) {
+            states_[e.target].fail = 0;
+            queue.push_back(e.target);
+        }
+        states_[0].out = npos;
+
+        for (std::size_t qi = 0; qi < queue.size(); ++qi) {
+            std::uint32_t const s = queue[qi];
+            state& st = states_[s];
+
+            // The longest key which is a suffix of this state's string
+            st.out = st.value != npos ? s : states_[st.fail].out;
+
+            for (auto const& e : st.trans) {
+                std::uint32_t f = st.fail;
+                std::uint32_t target = npos;
+                while (true) {
+                    target = this->transition(f, e.label);
+                    if (target != npos || f == 0) break;
+                    f = states_[f].fail;
+                }
+                states_[e.target].fail = target != npos ? target : 0;
+                queue.push_back(e.target);
+            }
+        }
+
+        compiled_ = true;
+    }
+
+    [[nodiscard]] bool compiled() const noexcept { return compiled_; }
+    [[nodiscard]] std::size_t size() const noexcept { return values_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return values_.empty(); }
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se>
+    [[nodiscard]] std::optional<match<It>> find(It first, Se const& last) const
+    {
+        return this->find(std::move(first), last, [](It const&) noexcept { return true; });
+    }
+
+    // As above, calling `step(it)` before examining each input position `it`.
+    // The search is abandoned, finding nothing, once it returns `false`.
+    template<std::forward_iterator It, std::sentinel_for<It> Se, std::predicate<It const&> Step>
+    [[nodiscard]] std::optional<match<It>> find(It first, Se const& last, Step step) const
+    {
+        assert(compiled_ && "aho_corasick::compile() must be called before find()");
+        if (values_.empty()) return std::nullopt;
+
+        std::optional<match<It>> best;
+        std::uint32_t s = 0;
+        std::size_t i = 0; // offset of `first`
+
+        while (first != last) {
+            if (!step(std::as_const(first))) return std::nullopt;
+
+            if (s == 0) {
+                // Prefilter: nothing can start here unless the char begins some key
+                while (!first_chars_.test(low_byte(*first))) {
+                    if (best) return best;
+                    ++first;
+                    ++i;
+                    if (first == last) return best;
+                    if (!step(std::as_const(first))) return std::nullopt;
+                }
+            }
+
+            Char const c = *first;
+            ++first;
+            ++i;
+
+            while (true) {
+                std::uint32_t const next = this->transition(s, c);
+                if (next != npos) {
+                    s = next;
+                    break;
+                }
+                if (s == 0) break;
+                s = states_[s].fail;
+            }
+
+            if (std::uint32_t const o = states_[s].out; o != npos) {
+                std::size_t const len = states_[o].depth;
+                std::size_t const start = i - len;
+                if (!best || start < best->offset || (start == best->offset && len > best->length)) {
+                    best = match<It>{first, start, len, &values_[states_[o].value]};
+                }
+            }
+
+            // Any match still in progress starts at `i - depth`; once that is
+            // past the best start, no leftmost or longer match can follow
+            if (best && i - states_[s].depth > best->offset) break;
+        }
+        return best;
+    }
+
+private:
+    static constexpr std::uint32_t npos = 0xFFFFFFFF;
+
+    struct edge
+    {
+        Char label;
+        std::uint32_t target;
+    };
+
+    struct state
+    {
+        std::vector<edge> trans; // sorted by label
+        std::uint32_t fail = 0;
+        std::uint32_t out = npos;   // state of the longest key which is a suffix of this state
+        std::uint32_t value = npos; // index into `values_` if this state ends a key
+        std::uint32_t depth = 0;
+    };
+
+    [[nodiscard]] static constexpr std::size_t low_byte(Char c) noexcept
+    {
+        return static_cast<std::size_t>(static_cast<std::make_unsigned_t<Char>>(c) & 0xFF);
+    }
+
+    [[nodiscard]] std::uint32_t transition(std::uint32_t s, Char c) const noexcept
+    {
+        auto const& trans = states_[s].trans;
+        if (trans.size() <= 8) {
+            for (auto const& e : trans) {
+                if (e.label == c) return e.target;
+            }
+            return npos;
+        }
+        auto const it = std::ranges::lower_bound(trans, c, {}, &edge::label);
+        return it != trans.end() && it->label == c ? it->target : npos;
+    }
+
+    std::vector<state> states_;
+    std::vector<T> values_;
+    std::bitset<256> first_chars_;
+    bool compiled_ = false;
+};
+
+} // iris::x4
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef IRIS_X4_STRING_CONCURRENT_LOOKUP_HPP
+#define IRIS_X4_STRING_CONCURRENT_LOOKUP_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#include <iris/config.hpp>
+
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace iris::x4 {
+
+// A copy-on-write wrapper which makes any `Lookup` (e.g. `tst`) safe to
+// update while other threads are parsing with it.
+//
+// Readers take an immutable snapshot with a single atomic load and never lock.
+// Writers are serialized by a mutex; each call to `update` copies the current
+// table once, applies all modifications to the copy, and then publishes it
+// atomically. Use `update` to batch many modifications, since `add`, `remove`
+// and `clear` each publish a new snapshot.
+//
+// Snapshots are kept alive by the readers that hold them, so a parse that
+// started before an update keeps seeing a consistent table.
+template<class Lookup>
+struct concurrent_lookup
+{
+    using lookup_type = Lookup;
+    using snapshot_type = std::shared_ptr<Lookup const>;
+
+    concurrent_lookup()
+        : current_(std::make_shared<Lookup const>())
+    {
+    }
+
+    explicit concurrent_lookup(Lookup table)
+        : current_(std::make_shared<Lookup const>(std::move(table)))
+    {
+    }
+
+    // Copies share the (immutable) snapshot; subsequent updates diverge.
+    concurrent_lookup(concurrent_lookup const& other)
+        : current_(other.snapshot())
+    {
+    }
+
+    concurrent_lookup& operator=(concurrent_lookup const& other)
+    {
+        if (this == std::addressof(other)) return *this;
+        std::scoped_lock lock(write_mutex_);
+        current_.store(other.snapshot(), std::memory_order_release);
+        return *this;
+    }
+
+    [[nodiscard]] snapshot_type snapshot() const noexcept
+    {
+        return current_.load(std::memory_order_acquire);
+    }
+
+    // Invokes `f(Lookup&)` on a private copy of the current table, then
+    // publishes the result.
+    template<class F>
+    void update(F&& f)
+    {
+        std::scoped_lock lock(write_mutex_);
+        auto next = std::make_shared<Lookup>(*current_.load(std::memory_order_relaxed));
+        std::invoke(std::forward<F>(f), *next);
+        current_.store(std::move(next), std::memory_order_release);
+    }
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Val>
+    void add(It first, Se last, Val&& val)
+    {
+        this->update([&](Lookup& table) {
+            (void)table.add(std::move(first), std::move(last), std::forward<Val>(val));
+        });
+    }
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se>
+    void remove(It first, Se last)
+    {
+        this->update([&](Lookup& table) {
+            table.remove(std::move(first), std::move(last));
+        });
+    }
+
+    void clear()
+    {
+        std::scoped_lock lock(write_mutex_);
+        current_.store(std::make_shared<Lookup const>(), std::memory_order_release);
+    }
+
+    template<class F>
+    void for_each(F&& f) const
+    {
+        this->snapshot()->for_each(std::forward<F>(f));
+    }
+
+private:
+    std::atomic<snapshot_type> current_;
+    std::mutex write_mutex_;
+};
+
+} // iris::x4
+
+#endif
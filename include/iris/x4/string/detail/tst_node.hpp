@@ -141,17 +141,20 @@ struct tst_node
         return found;
     }
 
+    // `key` holds the prefix on entry and is restored on exit, so that
+    // a single buffer is reused for the whole traversal
     template<class F>
     static void
-    for_each(tst_node* const p, std::basic_string_view<Char> const prefix, F&& f)
+    for_each(tst_node* const p, std::basic_string<Char>& key, F& f)
     {
         if (!p) return;
 
-        tst_node::for_each(p->lt, prefix, f);
-        std::basic_string<Char> s = std::basic_string<Char>(prefix) + p->id;
-        tst_node::for_each(p->eq, s, f);
-        if (p->data) f(s, *p->data);
-        tst_node::for_each(p->gt, prefix, f);
+        tst_node::for_each(p->lt, key, f);
+        key.push_back(p->id);
+        tst_node::for_each(p->eq, key, f);
+        if (p->data) f(std::as_const(key), *p->data);
+        key.pop_back();
+        tst_node::for_each(p->gt, key, f);
     }
 
     friend struct allocator_ops<tst_node>;
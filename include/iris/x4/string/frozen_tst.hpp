@@ -0,0 +1,359 @@
+#ifndef IRIS_X4_STRING_FROZEN_TST_HPP
+#define IRIS_X4_STRING_FROZEN_TST_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/string/tst.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cassert>
+
+// `frozen_tst` is a read-only ternary search tree stored in a single,
+// position-independent byte buffer. The buffer is produced (typically offline)
+// by `frozen_tst_builder` and can be written to a file as-is; at runtime, map
+// the file into memory and hand the bytes to `frozen_tst::load`. No per-entry
+// allocation takes place, and the nodes are shared with the page cache.
+//
+// The format is native-endian and ABI-specific (the character size and the
+// size/alignment of `T` are recorded and checked on load). Links are stored as
+// 32-bit indices into the node array.
+//
+// `frozen_tst` satisfies the `Lookup` interface required by
+// `unique_symbols_parser` and `shared_symbols_parser`, except for `add` and
+// `remove`.
+
+namespace iris::x4 {
+
+namespace detail {
+
+inline constexpr std::uint32_t frozen_tst_magic = 0x54535446; // "FTST" in little-endian
+inline constexpr std::uint32_t frozen_tst_version = 1;
+inline constexpr std::uint32_t frozen_tst_npos = 0xFFFFFFFF;
+
+struct frozen_tst_header
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t char_size;
+    std::uint32_t value_size;
+    std::uint32_t value_align;
+    std::uint32_t node_size;
+    std::uint32_t node_count;
+    std::uint32_t value_count;
+    std::uint32_t nodes_offset;
+    std::uint32_t values_offset;
+    std::uint64_t total_size;
+};
+
+// Padding-free, so that the serialized bytes are fully deterministic
+struct frozen_tst_node
+{
+    std::uint32_t id;                      // the node's identity character
+    std::uint32_t data = frozen_tst_npos;  // index into the value array
+    std::uint32_t lt = frozen_tst_npos;    // left index
+    std::uint32_t eq = frozen_tst_npos;    // middle index
+    std::uint32_t gt = frozen_tst_npos;    // right index
+};
+
+static_assert(std::is_trivially_copyable_v<frozen_tst_header>);
+static_assert(std::is_trivially_copyable_v<frozen_tst_node>);
+static_assert(sizeof(frozen_tst_node) == 5 * sizeof(std::uint32_t));
+
+[[nodiscard]] constexpr std::size_t frozen_tst_align_up(std::size_t n, std::size_t align) noexcept
+{
+    return (n + align - 1) / align * align;
+}
+
+} // detail
+
+template<class Char, class T>
+struct frozen_tst
+{
+    static_assert(std::is_trivially_copyable_v<T>, "frozen_tst requires a trivially copyable value type");
+    static_assert(sizeof(Char) <= sizeof(std::uint32_t));
+
+    using char_type = Char;
+    using value_type = T;
+    using node = detail::frozen_tst_node;
+
+    constexpr frozen_tst() noexcept = default;
+
+    // Returns `std::nullopt` if `bytes` is not a well-formed image for this
+    // `Char`/`T` combination, or if it is not suitably aligned. Only the header
+    // and the section bounds are checked here; call `verify()` to also check
+    // every link (e.g. when the file comes from an untrusted source).
+    [[nodiscard]] static std::optional<frozen_tst>
+    load(std::span<std::byte const> bytes) noexcept
+    {
+        detail::frozen_tst_header h;
+        if (bytes.size() < sizeof(h)) return std::nullopt;
+        std::memcpy(&h, bytes.data(), sizeof(h));
+
+        if (h.magic != detail::frozen_tst_magic) return std::nullopt;
+        if (h.version != detail::frozen_tst_version) return std::nullopt;
+        if (h.char_size != sizeof(Char)) return std::nullopt;
+        if (h.value_size != sizeof(T) || h.value_align != alignof(T)) return std::nullopt;
+        if (h.node_size != sizeof(node)) return std::nullopt;
+        if (h.total_size != bytes.size()) return std::nullopt;
+
+        if (h.nodes_offset % alignof(node) != 0 || h.values_offset % alignof(T) != 0) return std::nullopt;
+        if (h.nodes_offset < sizeof(h) || h.nodes_offset + std::uint64_t{h.node_count} * sizeof(node) > h.values_offset) return std::nullopt;
+        if (h.values_offset + std::uint64_t{h.value_count} * sizeof(T) > h.total_size) return std::nullopt;
+
+        auto const base = std::bit_cast<std::uintptr_t>(bytes.data());
+        if (base % alignof(node) != 0 || base % alignof(T) != 0) return std::nullopt;
+
+        frozen_tst res;
+        res.bytes_ = bytes;
+        res.nodes_ = reinterpret_cast<node const*>(bytes.data() + h.nodes_offset);
+        res.values_ = reinterpret_cast<T const*>(bytes.data() + h.values_offset);
+        res.node_count_ = h.node_count;
+        res.value_count_ = h.value_count;
+        return res;
+    }
+
+    // Checks that every link and value index is in range, and that every link
+    // points forward (the builder always places a child after its parent), so
+    // that `find` and `for_each` terminate on any image that passes.
+    // O(number of nodes).
+    [[nodiscard]] bool verify() const noexcept
+    {
+        for (std::uint32_t i = 0; i < node_count_; ++i) {
+            auto const valid_link = [this, i](std::uint32_t link) {
+                return link == detail::frozen_tst_npos || (link > i && link < node_count_);
+            };
+            node const& p = nodes_[i];
+            if (!valid_link(p.lt) || !valid_link(p.eq) || !valid_link(p.gt)) return false;
+            if (p.data != detail::frozen_tst_npos && p.data >= value_count_) return false;
+        }
+        return true;
+    }
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class CaseCompare>
+    [[nodiscard]] T const* find(It& first, Se const& last, CaseCompare const& comp) const noexcept
+    {
+        if (first == last || node_count_ == 0) return nullptr;
+
+        It it = first;
+        It latest = first;
+        std::uint32_t i = 0;
+        T const* found = nullptr;
+
+        while (i != detail::frozen_tst_npos && it != last) {
+            node const& p = nodes_[i];
+            auto c = comp(*it, static_cast<Char>(p.id));
+
+            if (c == 0) {
+                if (p.data != detail::frozen_tst_npos) {
+                    found = values_ + p.data;
+                    latest = it;
+                }
+                i = p.eq;
+                ++it;
+
+            } else if (c < 0) {
+                i = p.lt;
+
+            } else {
+                i = p.gt;
+            }
+        }
+
+        if (found) {
+            first = ++latest; // one past the last matching char
+        }
+        return found;
+    }
+
+    // Detaches from the underlying buffer; the buffer itself is not touched.
+    constexpr void clear() noexcept
+    {
+        *this = frozen_tst{};
+    }
+
+    template<class F>
+    void for_each(F&& f) const
+    {
+        if (node_count_ == 0) return;
+        std::basic_string<Char> key;
+        this->for_each_impl(0, key, f);
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return value_count_; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return value_count_ == 0; }
+    [[nodiscard]] constexpr std::span<std::byte const> bytes() const noexcept { return bytes_; }
+
+private:
+    template<class F>
+    void for_each_impl(std::uint32_t i, std::basic_string<Char>& key, F& f) const
+    {
+        if (i == detail::frozen_tst_npos) return;
+        node const& p = nodes_[i];
+
+        this->for_each_impl(p.lt, key, f);
+        key.push_back(static_cast<Char>(p.id));
+        this->for_each_impl(p.eq, key, f);
+        if (p.data != detail::frozen_tst_npos) f(std::as_const(key), values_[p.data]);
+        key.pop_back();
+        this->for_each_impl(p.gt, key, f);
+    }
+
+    std::span<std::byte const> bytes_;
+    node const* nodes_ = nullptr;
+    T const* values_ = nullptr;
+    std::uint32_t node_count_ = 0;
+    std::uint32_t value_count_ = 0;
+};
+
+template<class Char, class T>
+struct frozen_tst_builder
+{
+    static_assert(std::is_trivially_copyable_v<T>, "frozen_tst requires a trivially copyable value type");
+
+    using char_type = Char;
+    using value_type = T;
+
+    // As with `tst::add`, the first value added for a given key wins, and
+    // empty keys are ignored.
+    void add(std::basic_string_view<Char> const key, T const& val)
+    {
+        if (key.empty()) return;
+        entries_.emplace_back(std::basic_string<Char>(key), val);
+    }
+
+    template<class Alloc>
+    void add(tst<Char, T, Alloc> const& t)
+    {
+        t.for_each([this](std::basic_string<Char> const& key, T const& val) {
+            this->add(key, val);
+        });
+    }
+
+    void reserve(std::size_t n)
+    {
+        entries_.reserve(n);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return entries_.size();
+    }
+
+    // Produces the serialized image. The result can be passed directly to
+    // `frozen_tst::load`, or written to a file and memory-mapped later.
+    [[nodiscard]] std::vector<std::byte> build() const
+    {
+        using node = detail::frozen_tst_node;
+
+        std::vector<entry const*> sorted;
+        sorted.reserve(entries_.size());
+        for (auto const& e : entries_) sorted.push_back(&e);
+        std::ranges::stable_sort(sorted, {}, [](entry const* e) -> auto const& { return e->first; });
+        auto const dup = std::ranges::unique(sorted, {}, [](entry const* e) -> auto const& { return e->first; });
+        sorted.erase(dup.begin(), dup.end());
+
+        std::vector<node> nodes;
+        // Insert the median of each range first so that the lt/gt links form
+        // a balanced tree, which bounds the number of sibling hops per char
+        auto const insert_range = [&](this auto const& self, std::size_t lo, std::size_t hi) -> void {
+            if (lo >= hi) return;
+            std::size_t const mid = lo + (hi - lo) / 2;
+            insert(nodes, sorted[mid]->first, static_cast<std::uint32_t>(mid));
+            self(lo, mid);
+            self(mid + 1, hi);
+        };
+        insert_range(0, sorted.size());
+
+        assert(nodes.size() < detail::frozen_tst_npos);
+
+        detail::frozen_tst_header h{};
+        h.magic = detail::frozen_tst_magic;
+        h.version = detail::frozen_tst_version;
+        h.char_size = sizeof(Char);
+        h.value_size = sizeof(T);
+        h.value_align = alignof(T);
+        h.node_size = sizeof(node);
+        h.node_count = static_cast<std::uint32_t>(nodes.size());
+        h.value_count = static_cast<std::uint32_t>(sorted.size());
+        h.nodes_offset = static_cast<std::uint32_t>(detail::frozen_tst_align_up(sizeof(h), alignof(node)));
+        h.values_offset = static_cast<std::uint32_t>(detail::frozen_tst_align_up(h.nodes_offset + nodes.size() * sizeof(node), alignof(T)));
+        h.total_size = h.values_offset + sorted.size() * sizeof(T);
+
+        std::vector<std::byte> out(h.total_size);
+        std::memcpy(out.data(), &h, sizeof(h));
+        if (!nodes.empty()) {
+            std::memcpy(out.data() + h.nodes_offset, nodes.data(), nodes.size() * sizeof(node));
+        }
+        for (std::size_t i = 0; i < sorted.size(); ++i) {
+            std::memcpy(out.data() + h.values_offset + i * sizeof(T), std::addressof(sorted[i]->second), sizeof(T));
+        }
+        return out;
+    }
+
+private:
+    using entry = std::pair<std::basic_string<Char>, T>;
+
+    static void insert(std::vector<detail::frozen_tst_node>& nodes, std::basic_string_view<Char> const key, std::uint32_t value_index)
+    {
+        using node = detail::frozen_tst_node;
+        assert(!key.empty());
+
+        auto const make_node = [](Char c) { return node{.id = static_cast<std::uint32_t>(c)}; };
+
+        if (nodes.empty()) nodes.push_back(make_node(key[0]));
+
+        std::uint32_t i = 0;
+        std::size_t pos = 0;
+        Char c = key[0];
+
+        while (true) {
+            std::uint32_t node::* link;
+
+            if (c == static_cast<Char>(nodes[i].id)) {
+                if (++pos == key.size()) {
+                    if (nodes[i].data == detail::frozen_tst_npos) nodes[i].data = value_index;
+                    return;
+                }
+                link = &node::eq;
+                c = key[pos];
+
+            } else if (c < static_cast<Char>(nodes[i].id)) {
+                link = &node::lt;
+            } else {
+                link = &node::gt;
+            }
+
+            if (nodes[i].*link == detail::frozen_tst_npos) {
+                auto const next = static_cast<std::uint32_t>(nodes.size());
+                nodes.push_back(make_node(c));
+                nodes[i].*link = next;
+            }
+            i = nodes[i].*link;
+        }
+    }
+
+    std::vector<entry> entries_;
+};
+
+} // iris::x4
+
+#endif
@@ -0,0 +1,183 @@
+#ifndef IRIS_X4_STRING_LITERAL_SEQUENCE_HPP
+#define IRIS_X4_STRING_LITERAL_SEQUENCE_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/core/parser.hpp>
+#include <iris/x4/core/skip_over.hpp>
+#include <iris/x4/core/unused.hpp>
+
+#include <iris/x4/string/case_compare.hpp>
+#include <iris/x4/string/utf8.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace iris::x4 {
+
+// One segment of a `literal_sequence`
+template<class CharT>
+struct literal_segment
+{
+    std::basic_string_view<CharT> str; // unless `is_char`
+    CharT ch{};                        // if `is_char`
+    bool is_char = false;
+    bool skip = true; // pre-skip before matching the characters
+
+    [[nodiscard]] constexpr std::basic_string_view<CharT> chars() const noexcept
+    {
+        return is_char ? std::basic_string_view<CharT>(&ch, 1) : str;
+    }
+
+    // Removes the first `n` characters
+    constexpr void remove_prefix(std::size_t const n) noexcept
+    {
+        if (n == 0) return;
+        if (is_char) {
+            is_char = false;
+            str = {};
+        } else {
+            str.remove_prefix(n);
+        }
+    }
+};
+
+// An attribute-less run of `N` literal segments, each optionally preceded by
+// a pre-skip. `lit("ab") >> 'c'` is equivalent to a `literal_sequence` with
+// the segments {"ab", skip} and {'c', skip}.
+//
+// This is the fused form produced by `x4::optimize`; the whole sequence is
+// matched in a single loop instead of through nested `sequence`s. Under a
+// skipper, each segment still pre-skips as the original literal did.
+//
+// The segments are held in a fixed-size array, so that a `literal_sequence`
+// never allocates and is usable in constant expressions. A string segment
+// refers to the characters of the literal it was made from, which must
+// therefore outlive it; `x4::optimize` only fuses string literals that do not
+// own their characters (e.g. `lit("abc")`).
+template<class Encoding, std::size_t N = 1>
+struct literal_sequence : parser<literal_sequence<Encoding, N>>
+{
+    using char_type = typename Encoding::char_type;
+    using encoding = Encoding;
+    using attribute_type = unused_type;
+
+    static constexpr bool has_attribute = false;
+
+    using segment = literal_segment<char_type>;
+
+    constexpr literal_sequence() = default;
+
+    constexpr explicit literal_sequence(std::basic_string_view<char_type> const str, bool const skip = true) noexcept
+        requires (N == 1)
+        : segments{segment{.str = str, .skip = skip}}
+    {}
+
+    constexpr explicit literal_sequence(char_type const ch, bool const skip = true) noexcept
+        requires (N == 1)
+        : segments{segment{.ch = ch, .is_char = true, .skip = skip}}
+    {}
+
+    constexpr explicit literal_sequence(std::array<segment, N> const& segments) noexcept
+        : segments(segments)
+    {}
+
+    // The segments of `*this` followed by those of `other`
+    template<std::size_t M>
+    [[nodiscard]] constexpr literal_sequence<Encoding, N + M>
+    append(literal_sequence<Encoding, M> const& other) const noexcept
+    {
+        std::array<segment, N + M> res{};
+        std::ranges::copy(segments, res.begin());
+        std::ranges::copy(other.segments, res.begin() + N);
+        return literal_sequence<Encoding, N + M>(res);
+    }
+
+    // The length of the longest common prefix of the first segments of
+    // `*this` and `other`, which must agree on pre-skipping
+    template<std::size_t M>
+    [[nodiscard]] constexpr std::size_t
+    common_prefix_length(literal_sequence<Encoding, M> const& other) const noexcept
+    {
+        auto const& sa = segments.front();
+        auto const& sb = other.segments.front();
+        if (sa.skip != sb.skip) return 0;
+
+        auto const a = sa.chars();
+        auto const b = sb.chars();
+        return static_cast<std::size_t>(std::ranges::mismatch(a, b).in1 - a.begin());
+    }
+
+    // Removes the first `n` characters of the first segment and returns them
+    // as a new sequence. The remainder no longer pre-skips, since matching the
+    // returned prefix already did so. If `n` is zero, the returned sequence
+    // matches the empty string without pre-skipping.
+    [[nodiscard]] constexpr literal_sequence<Encoding, 1>
+    extract_prefix(std::size_t const n) noexcept
+    {
+        segment& s = segments.front();
+        if (n == 0) return literal_sequence<Encoding, 1>(std::basic_string_view<char_type>{}, false);
+
+        literal_sequence<Encoding, 1> prefix = s.is_char
+            ? literal_sequence<Encoding, 1>(s.ch, s.skip)
+            : literal_sequence<Encoding, 1>(s.str.substr(0, n), s.skip);
+        s.remove_prefix(n);
+        s.skip = false;
+        return prefix;
+    }
+
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
+    [[nodiscard]] constexpr bool
+    parse(It& first, Se const& last, Context const& ctx, Attr const&) const
+        noexcept(noexcept(x4::skip_over(first, last, ctx)) && std::is_nothrow_copy_assignable_v<It>)
+    {
+        static_assert(std::same_as<std::iter_value_t<It>, char_type>, "Mixing incompatible char types is not allowed");
+
+        auto const& compare = x4::get_case_compare<encoding>(ctx);
+        It const first_saved = first;
+
+        for (auto const& seg : segments) {
+            if (seg.skip) x4::skip_over(first, last, ctx);
+
+            for (char_type const ch : seg.chars()) {
+                if (first == last || compare(ch, *first) != 0) {
+                    first = first_saved;
+                    return false;
+                }
+                ++first;
+            }
+        }
+        return true;
+    }
+
+    std::array<segment, N> segments{};
+};
+
+template<class Encoding, std::size_t N>
+struct get_info<literal_sequence<Encoding, N>>
+{
+    using result_type = std::string;
+    [[nodiscard]] constexpr std::string operator()(literal_sequence<Encoding, N> const& p) const
+    {
+        std::basic_string<typename Encoding::char_type> str;
+        for (auto const& seg : p.segments) {
+            str += seg.chars();
+        }
+        return '"' + x4::to_utf8(str) + '"';
+    }
+};
+
+} // iris::x4
+
+#endif
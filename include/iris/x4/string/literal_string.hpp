@@ -19,6 +19,7 @@
 #include <iris/x4/string/case_compare.hpp>
 #include <iris/x4/string/utf8.hpp>
 
+#include <concepts>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -77,6 +78,15 @@ struct get_info<literal_string<String, Encoding, Attr>>
     {
         return '"' + x4::to_utf8(p.str) + '"';
     }
+
+    // The characters to be quoted, which expectation failures copy into
+    // their own storage instead of building the description above
+    [[nodiscard]] static constexpr std::string_view
+    quoted_text(literal_string<String, Encoding, Attr> const& p) noexcept
+        requires std::same_as<typename Encoding::char_type, char>
+    {
+        return p.str;
+    }
 };
 
 } // iris::x4
@@ -14,11 +14,14 @@
 #include <iris/x4/string/detail/tst_node.hpp>
 #include <iris/x4/allocator.hpp>
 
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <cassert>
 
@@ -33,6 +36,178 @@ struct tst_pass_through
     }
 };
 
+// A forward-only cursor over the entries of a `tst`, in lexicographic order.
+// The key is assembled in a single buffer which is reused across entries (and
+// across calls to `tst::prefix_range` when the cursor itself is reused).
+// Modifying the `tst` invalidates the cursor.
+//
+// The cursor is also an input range of `std::pair<std::basic_string_view<Char>, T&>`,
+// so a bounded query can be written as `t.prefix_range(p) | std::views::take(k)`.
+// A const `tst` gives a `tst_cursor<Char, T const>`, which only yields
+// `T const&`.
+template<class Char, class T>
+struct tst_cursor
+{
+    using node = detail::tst_node<Char, std::remove_const_t<T>>;
+    using node_pointer = std::conditional_t<std::is_const_v<T>, node const*, node*>;
+    using value_type = std::pair<std::basic_string_view<Char>, T&>;
+
+    struct sentinel {};
+
+    struct iterator
+    {
+        using value_type = tst_cursor::value_type;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::input_iterator_tag;
+
+        [[nodiscard]] constexpr value_type operator*() const noexcept
+        {
+            return {cursor->key(), cursor->value()};
+        }
+
+        constexpr iterator& operator++()
+        {
+            cursor->next();
+            return *this;
+        }
+
+        constexpr void operator++(int)
+        {
+            cursor->next();
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(iterator const& it, sentinel) noexcept
+        {
+            return !it.cursor->valid();
+        }
+
+        tst_cursor* cursor = nullptr;
+    };
+
+    constexpr tst_cursor() noexcept = default;
+
+    // Whether the cursor points to an entry
+    [[nodiscard]] constexpr bool valid() const noexcept
+    {
+        return value_ != nullptr;
+    }
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept
+    {
+        return this->valid();
+    }
+
+    [[nodiscard]] constexpr std::basic_string_view<Char> key() const noexcept
+    {
+        assert(this->valid());
+        return key_;
+    }
+
+    [[nodiscard]] constexpr T& value() const noexcept
+    {
+        assert(this->valid());
+        return *value_;
+    }
+
+    // Advances to the next entry; returns `false` when exhausted
+    constexpr bool next()
+    {
+        value_ = nullptr;
+
+        while (!stack_.empty()) {
+            frame& f = stack_.back();
+            node_pointer const p = f.p;
+
+            switch (f.next) {
+            case step::lt:
+                f.next = step::self;
+                if (p->lt) stack_.push_back({p->lt, f.depth, step::lt});
+                break;
+
+            case step::self:
+                f.next = step::eq;
+                key_.resize(f.depth);
+                key_.push_back(p->id);
+                if (p->data) {
+                    value_ = p->data;
+                    return true;
+                }
+                break;
+
+            case step::eq:
+                f.next = step::gt;
+                if (p->eq) stack_.push_back({p->eq, f.depth + 1, step::lt});
+                break;
+
+            case step::gt: {
+                std::size_t const depth = f.depth;
+                stack_.pop_back(); // the right subtree replaces this frame
+                if (p->gt) stack_.push_back({p->gt, depth, step::lt});
+                break;
+            }
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]] constexpr iterator begin() noexcept { return {this}; }
+    [[nodiscard]] constexpr sentinel end() const noexcept { return {}; }
+
+private:
+    template<class, class, class>
+    friend struct tst;
+
+    enum class step : unsigned char { lt, self, eq, gt };
+
+    struct frame
+    {
+        node_pointer p;
+        std::size_t depth; // length of the key preceding `p->id`
+        step next; // what to do when this frame is resumed
+    };
+
+    constexpr void reset(node_pointer root, std::basic_string_view<Char> const prefix)
+    {
+        stack_.clear();
+        key_.assign(prefix);
+        value_ = nullptr;
+
+        if (prefix.empty()) {
+            if (root) stack_.push_back({root, 0, step::lt});
+            this->next();
+            return;
+        }
+
+        // Locate the node for the last character of `prefix`
+        node_pointer p = root;
+        std::size_t i = 0;
+        while (p) {
+            if (prefix[i] == p->id) {
+                if (++i == prefix.size()) break;
+                p = p->eq;
+            } else if (prefix[i] < p->id) {
+                p = p->lt;
+            } else {
+                p = p->gt;
+            }
+        }
+        if (!p) return;
+
+        if (p->eq) stack_.push_back({p->eq, prefix.size(), step::lt});
+
+        if (p->data) {
+            // `prefix` itself is an entry and comes first
+            value_ = p->data;
+        } else {
+            this->next();
+        }
+    }
+
+    std::basic_string<Char> key_;
+    std::vector<frame> stack_;
+    T* value_ = nullptr;
+};
+
 template<class Char, class T, class Alloc = std::allocator<T>>
 struct tst
 {
@@ -120,7 +295,36 @@ struct tst
     template<class F>
     constexpr void for_each(F&& f) const
     {
-        node::for_each(root_, {}, std::forward<F>(f));
+        std::basic_string<Char> key;
+        node::for_each(root_, key, f);
+    }
+
+    // Returns a cursor over all entries whose key starts with `prefix`, in
+    // lexicographic order.
+    [[nodiscard]] constexpr tst_cursor<Char, T> prefix_range(std::basic_string_view<Char> const prefix = {})
+    {
+        tst_cursor<Char, T> cursor;
+        this->prefix_range(prefix, cursor);
+        return cursor;
+    }
+
+    [[nodiscard]] constexpr tst_cursor<Char, T const> prefix_range(std::basic_string_view<Char> const prefix = {}) const
+    {
+        tst_cursor<Char, T const> cursor;
+        this->prefix_range(prefix, cursor);
+        return cursor;
+    }
+
+    // Repositions an existing cursor, reusing its buffers. Once the buffers
+    // have grown to fit the table, this does not allocate.
+    constexpr void prefix_range(std::basic_string_view<Char> const prefix, tst_cursor<Char, T>& cursor)
+    {
+        cursor.reset(root_, prefix);
+    }
+
+    constexpr void prefix_range(std::basic_string_view<Char> const prefix, tst_cursor<Char, T const>& cursor) const
+    {
+        cursor.reset(root_, prefix);
     }
 
     friend struct allocator_ops<tst>;
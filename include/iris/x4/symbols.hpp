@@ -20,6 +20,7 @@
 #include <iris/x4/traits/string_traits.hpp>
 
 #include <iris/x4/string/tst.hpp>
+#include <iris/x4/string/concurrent_lookup.hpp>
 #include <iris/x4/string/case_compare.hpp>
 
 #include <iris/x4/char_encoding/standard.hpp>
@@ -35,6 +36,7 @@
 #include <iterator>
 #include <initializer_list>
 #include <memory>
+#include <functional>
 #include <type_traits>
 #include <utility>
 
@@ -51,6 +53,23 @@ namespace iris::x4 {
 
 namespace detail {
 
+// A `Lookup` which hands out immutable snapshots (e.g. `concurrent_lookup`)
+template<class Lookup>
+concept SnapshotLookup = requires(Lookup const& lookup) {
+    { *lookup.snapshot() };
+};
+
+// A `Lookup` whose `find` hands out mutable values (e.g. `tst`, but not the
+// read-only `frozen_tst`)
+template<class Lookup, class Encoding, class T>
+concept MutableLookup = requires(
+    Lookup const& lookup,
+    typename std::basic_string_view<typename Encoding::char_type>::iterator& first,
+    typename std::basic_string_view<typename Encoding::char_type>::iterator const& last
+) {
+    { lookup.find(first, last, case_compare<Encoding>()) } -> std::same_as<T*>;
+};
+
 template<class Derived, bool IsShared, class Encoding, class T, class Lookup>
 struct symbols_parser_impl : parser<Derived>
 {
@@ -82,6 +101,25 @@ struct symbols_parser_impl : parser<Derived>
     {
     }
 
+    // Adopts a prebuilt lookup table (e.g. a memory-mapped `frozen_tst`)
+    constexpr explicit symbols_parser_impl(Lookup table, std::string_view name = "symbols")
+        requires(IsShared)
+        : add{*this}
+        , remove{*this}
+        , lookup(std::make_shared<Lookup>(std::move(table)))
+        , name_(name)
+    {
+    }
+
+    constexpr explicit symbols_parser_impl(Lookup table, std::string_view name = "symbols")
+        requires(!IsShared)
+        : add{*this}
+        , remove{*this}
+        , lookup(std::make_unique<Lookup>(std::move(table)))
+        , name_(name)
+    {
+    }
+
     constexpr symbols_parser_impl(symbols_parser_impl const& syms)
         requires(IsShared)
         : add{*this}
@@ -162,7 +200,7 @@ struct symbols_parser_impl : parser<Derived>
 
     constexpr symbols_parser_impl& operator=(symbols_parser_impl&&) = default;
 
-    constexpr void clear() noexcept
+    constexpr void clear() noexcept(noexcept(lookup->clear()))
     {
         lookup->clear();
     }
@@ -170,22 +208,28 @@ struct symbols_parser_impl : parser<Derived>
     struct adder;
     struct remover;
 
+    // For a `SnapshotLookup`, the new contents are published as a single
+    // snapshot, so readers never see a partially filled table.
     constexpr symbols_parser_impl& operator=(std::initializer_list<char_type const*> const& syms)
     {
-        lookup->clear();
-
-        for (auto const& sym : syms) {
-            this->add(sym);
-        }
-
+        this->update([&](auto& table) {
+            table.clear();
+            for (auto const& sym : syms) {
+                std::basic_string_view<char_type> const s = sym;
+                (void)table.add(s.begin(), s.end(), T{});
+            }
+        });
         return *this;
     }
 
     constexpr adder const&
     operator=(std::basic_string_view<char_type> const s)
     {
-        lookup->clear();
-        return this->add(s);
+        this->update([&](auto& table) {
+            table.clear();
+            (void)table.add(s.begin(), s.end(), T{});
+        });
+        return add;
     }
 
     friend constexpr adder const&
@@ -203,38 +247,104 @@ struct symbols_parser_impl : parser<Derived>
     template<class F>
     constexpr void for_each(F&& f) const
     {
-        lookup->for_each(std::forward<F>(f));
+        if constexpr (SnapshotLookup<Lookup>) {
+            lookup->snapshot()->for_each(std::forward<F>(f));
+        } else {
+            lookup->for_each(std::forward<F>(f));
+        }
     }
 
     template<class F>
     constexpr void for_each(F&& f)
     {
-        lookup->for_each(std::forward<F>(f));
+        if constexpr (SnapshotLookup<Lookup>) {
+            lookup->snapshot()->for_each(std::forward<F>(f));
+        } else {
+            lookup->for_each(std::forward<F>(f));
+        }
+    }
+
+    // Enumerates the entries starting with `prefix`; see `tst::prefix_range`.
+    // The values can only be modified through a non-const `symbols`. For a
+    // `SnapshotLookup`, use `snapshot()->prefix_range(...)` instead, so that
+    // the table outlives the cursor.
+    [[nodiscard]] constexpr auto prefix_range(std::basic_string_view<char_type> const prefix = {})
+        requires (!SnapshotLookup<Lookup>)
+    {
+        return lookup->prefix_range(prefix);
     }
 
+    [[nodiscard]] constexpr auto prefix_range(std::basic_string_view<char_type> const prefix = {}) const
+        requires (!SnapshotLookup<Lookup>)
+    {
+        return std::as_const(*lookup).prefix_range(prefix);
+    }
+
+    template<class Cursor>
+        requires (!SnapshotLookup<Lookup>)
+    constexpr void prefix_range(std::basic_string_view<char_type> const prefix, Cursor& cursor)
+    {
+        lookup->prefix_range(prefix, cursor);
+    }
+
+    template<class Cursor>
+        requires (!SnapshotLookup<Lookup>)
+    constexpr void prefix_range(std::basic_string_view<char_type> const prefix, Cursor& cursor) const
+    {
+        std::as_const(*lookup).prefix_range(prefix, cursor);
+    }
+
+    // Applies `f(Lookup&)` to the underlying table. For a `SnapshotLookup`,
+    // all modifications made by `f` are published as a single new snapshot.
+    template<class F>
+    constexpr void update(F&& f)
+    {
+        if constexpr (requires { lookup->update(std::forward<F>(f)); }) {
+            lookup->update(std::forward<F>(f));
+        } else {
+            std::invoke(std::forward<F>(f), *lookup);
+        }
+    }
+
+    // Returns a consistent view of the table which stays valid regardless of
+    // concurrent updates.
+    [[nodiscard]] auto snapshot() const noexcept
+        requires SnapshotLookup<Lookup>
+    {
+        return lookup->snapshot();
+    }
+
+    // Not available for a `SnapshotLookup`, whose tables are immutable; use
+    // `snapshot()->find(...)` or `update(...)` instead. The same applies to
+    // `find` and `prefix_find`.
     [[nodiscard]] constexpr value_type& at(std::basic_string_view<char_type> const s)
+        requires MutableLookup<Lookup, Encoding, T>
     {
         return *lookup->add(s.begin(), s.end(), T{});
     }
 
     template<std::forward_iterator Iterator>
+        requires MutableLookup<Lookup, Encoding, T>
     [[nodiscard]] constexpr value_type* prefix_find(Iterator& first, Iterator const& last) noexcept
     {
         return lookup->find(first, last, case_compare<Encoding>());
     }
 
     template<std::forward_iterator Iterator>
+        requires (!SnapshotLookup<Lookup>)
     [[nodiscard]] constexpr value_type const* prefix_find(Iterator& first, Iterator const& last) const noexcept
     {
         return lookup->find(first, last, case_compare<Encoding>());
     }
 
     [[nodiscard]] constexpr value_type* find(std::basic_string_view<char_type> const s) noexcept
+        requires MutableLookup<Lookup, Encoding, T>
     {
         return this->find_impl(s.begin(), s.end());
     }
 
     [[nodiscard]] constexpr value_type const* find(std::basic_string_view<char_type> const s) const noexcept
+        requires (!SnapshotLookup<Lookup>)
     {
         return this->find_impl(s.begin(), s.end());
     }
@@ -249,11 +359,25 @@ struct symbols_parser_impl : parser<Derived>
     {
         x4::skip_over(first, last, ctx);
 
-        if (value_type const* val_ptr = lookup->find(first, last, x4::get_case_compare<Encoding>(ctx))) {
-            x4::move_to(*val_ptr, attr);
-            return true;
+        if constexpr (SnapshotLookup<Lookup>) {
+            // Keep the snapshot alive until the value has been moved out
+            auto const snapshot = lookup->snapshot();
+            return symbols_parser_impl::parse_lookup(*snapshot, first, last, ctx, attr);
+        } else {
+            return symbols_parser_impl::parse_lookup(*lookup, first, last, ctx, attr);
         }
-        return false;
+    }
+
+    // Matches like `parse`, but returns a pointer to the stored value (or
+    // `nullptr`) instead of copying it; used by `ref_attr[...]`.
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Context>
+        requires (!SnapshotLookup<Lookup>)
+    [[nodiscard]] constexpr value_type const*
+    parse_ref(It& first, Se const& last, Context const& ctx) const
+        noexcept(noexcept(x4::skip_over(first, last, ctx)))
+    {
+        x4::skip_over(first, last, ctx);
+        return lookup->find(first, last, x4::get_case_compare<Encoding>(ctx));
     }
 
     constexpr void name(std::string const &str)
@@ -309,7 +433,20 @@ struct symbols_parser_impl : parser<Derived>
     [[maybe_unused]] remover remove;
 
 private:
+    template<class Table, std::forward_iterator It, std::sentinel_for<It> Se, class Context, X4Attribute Attr>
+    [[nodiscard]] static constexpr bool
+    parse_lookup(Table const& table, It& first, Se const& last, Context const& ctx, Attr& attr)
+        noexcept(noexcept(x4::move_to(std::declval<value_type const&>(), attr)))
+    {
+        if (value_type const* val_ptr = table.find(first, last, x4::get_case_compare<Encoding>(ctx))) {
+            x4::move_to(*val_ptr, attr);
+            return true;
+        }
+        return false;
+    }
+
     template<std::forward_iterator Iterator>
+        requires MutableLookup<Lookup, Encoding, T>
     [[nodiscard]] constexpr value_type* find_impl(Iterator begin, Iterator end) noexcept
     {
         value_type* r = lookup->find(begin, end, case_compare<Encoding>());
@@ -317,6 +454,7 @@ private:
     }
 
     template<std::forward_iterator Iterator>
+        requires (!SnapshotLookup<Lookup>)
     [[nodiscard]] constexpr value_type const* find_impl(Iterator begin, Iterator end) const noexcept
     {
         value_type const* r = lookup->find(begin, end, case_compare<Encoding>());
@@ -390,16 +528,21 @@ using shared_symbols = shared_symbols_parser<char_encoding::standard, T>;
 template<class T = unused_type>
 using unique_symbols = unique_symbols_parser<char_encoding::standard, T>;
 
+template<class T = unused_type>
+using concurrent_symbols = shared_symbols_parser<char_encoding::standard, T, concurrent_lookup<tst<char_encoding::standard::char_type, T>>>;
+
 } // standard
 
 using standard::symbols;
 using standard::shared_symbols;
 using standard::unique_symbols;
+using standard::concurrent_symbols;
 
 
 namespace parsers::standard {
 using x4::standard::shared_symbols;
 using x4::standard::unique_symbols;
+using x4::standard::concurrent_symbols;
 } // parsers::standard
 
 #ifndef IRIS_X4_NO_STANDARD_WIDE
@@ -415,11 +558,15 @@ using shared_symbols = shared_symbols_parser<char_encoding::standard_wide, T>;
 template<class T = unused_type>
 using unique_symbols = unique_symbols_parser<char_encoding::standard_wide, T>;
 
+template<class T = unused_type>
+using concurrent_symbols = shared_symbols_parser<char_encoding::standard_wide, T, concurrent_lookup<tst<char_encoding::standard_wide::char_type, T>>>;
+
 } // standard_wide
 
 namespace parsers::standard_wide {
 using x4::standard_wide::shared_symbols;
 using x4::standard_wide::unique_symbols;
+using x4::standard_wide::concurrent_symbols;
 } // parsers::standard_wide
 #endif
 
@@ -432,11 +579,15 @@ using shared_symbols = shared_symbols_parser<char_encoding::unicode, T>;
 template<class T = unused_type>
 using unique_symbols = unique_symbols_parser<char_encoding::unicode, T>;
 
+template<class T = unused_type>
+using concurrent_symbols = shared_symbols_parser<char_encoding::unicode, T, concurrent_lookup<tst<char_encoding::unicode::char_type, T>>>;
+
 } // unicode
 
 namespace parsers::unicode {
 using x4::unicode::shared_symbols;
 using x4::unicode::unique_symbols;
+using x4::unicode::concurrent_symbols;
 } // parsers::unicode
 #endif
 
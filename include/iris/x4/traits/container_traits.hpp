@@ -18,6 +18,8 @@
 #include <iris/alloy/tuple.hpp>
 
 #include <ranges>
+#include <concepts>
+#include <cstddef>
 #include <iterator>
 #include <vector>
 #include <string>
@@ -413,6 +415,78 @@ inline namespace cpos {
 
 } // cpos
 
+// Customization point
+template<class Container>
+struct reserve_container; // not defined
+
+namespace detail {
+
+// Makes room for `n` more elements, if the container supports it. This is a
+// hint only; it is a no-op for any other attribute (including `unused`).
+struct reserve_fn
+{
+    template<class Container>
+    static constexpr void operator()(Container&, std::size_t) noexcept
+    {
+    }
+
+    template<class Container>
+        requires
+            (!requires(Container& c, std::size_t n) { reserve_container<Container>::call(c, n); }) &&
+            requires(Container& c, std::size_t n) {
+                c.reserve(n);
+                { std::ranges::size(c) } -> std::convertible_to<std::size_t>;
+            }
+    static constexpr void operator()(Container& c, std::size_t const n)
+    {
+        if (n == 0) return;
+        std::size_t const required = static_cast<std::size_t>(std::ranges::size(c)) + n;
+
+        if constexpr (requires { { c.capacity() } -> std::convertible_to<std::size_t>; }) {
+            std::size_t const capacity = c.capacity();
+            if (required <= capacity) return;
+
+            // Keep the geometric growth, so that reserving inside a loop
+            // does not reallocate on every iteration
+            c.reserve(required < capacity * 2 ? capacity * 2 : required);
+        } else {
+            c.reserve(required);
+        }
+    }
+
+    template<class Container>
+        requires requires(Container& c, std::size_t n) {
+            reserve_container<Container>::call(c, n);
+        }
+    static constexpr void operator()(Container& c, std::size_t const n)
+        noexcept(noexcept(reserve_container<Container>::call(c, n)))
+    {
+        reserve_container<Container>::call(c, n);
+    }
+};
+
+} // detail
+
+inline namespace cpos {
+
+[[maybe_unused]] inline constexpr detail::reserve_fn reserve{};
+
+} // cpos
+
+// Customization point
+//
+// `container_element_buffer<Container>::call(c)` returns a reference to an
+// element owned by `c`, reset to the state of a freshly parsed-into value.
+// When specialized, each element is parsed into this buffer instead of a new
+// local value, and then pushed back as an rvalue referring to the buffer.
+template<class Container>
+struct container_element_buffer; // not defined
+
+template<class Container>
+concept HasElementBuffer = requires(Container& c) {
+    { container_element_buffer<Container>::call(c) } -> std::same_as<container_value_t<Container>&>;
+};
+
 // -------------------------------------------------
 
 // This is NOT a customization point. Don't specialize this.
@@ -14,6 +14,7 @@
 #include <iris/x4/core/move_to.hpp>
 #include <iris/x4/core/unused.hpp>
 
+#include <optional>
 #include <type_traits>
 #include <concepts>
 #include <utility>
@@ -54,6 +55,42 @@ concept Transformable = requires(Exposed& val) {
     { transform_attribute<Transformed, Exposed>::post(val, std::declval<Transformed>()) };
 };
 
+// Parses a `Transformed` attribute directly into the storage of an `Exposed`
+// attribute, instead of a temporary which is then transformed by `post`. A
+// specialization provides:
+//
+//   static Transformed* pre(Exposed&);
+//     The storage to parse into, or `nullptr` if a temporary must be used.
+//
+//   static void rollback(Exposed&);
+//     Restores the `Exposed` attribute after a failed parse into the storage
+//     returned by `pre`.
+template<class Transformed, class Exposed>
+struct transform_in_place; // not defined
+
+template<class Transformed, class Exposed>
+concept TransformableInPlace = requires(Exposed& val) {
+    { transform_in_place<Transformed, Exposed>::pre(val) } -> std::same_as<Transformed*>;
+    { transform_in_place<Transformed, Exposed>::rollback(val) };
+};
+
+// A disengaged `std::optional` is engaged and parsed into directly. An
+// engaged one keeps its value if the parse fails, so a temporary is used.
+template<class Transformed>
+struct transform_in_place<Transformed, std::optional<Transformed>>
+{
+    [[nodiscard]] static constexpr Transformed* pre(std::optional<Transformed>& val)
+        noexcept(std::is_nothrow_default_constructible_v<Transformed>)
+    {
+        return val.has_value() ? nullptr : &val.emplace();
+    }
+
+    static constexpr void rollback(std::optional<Transformed>& val) noexcept
+    {
+        val.reset();
+    }
+};
+
 // Same attribute types; no transformation needed
 template<X4Attribute Attr>
     requires
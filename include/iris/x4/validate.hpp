@@ -0,0 +1,111 @@
+#ifndef IRIS_X4_VALIDATE_HPP
+#define IRIS_X4_VALIDATE_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/config.hpp>
+#include <iris/x4/parse.hpp>
+#include <iris/x4/core/validation.hpp>
+
+#include <iterator>
+#include <ranges>
+#include <utility>
+
+namespace iris::x4 {
+
+// Used for determining the context type required in `IRIS_X4_INSTANTIATE`
+// for rules which are invoked via `validate(...)`.
+template<class ItOrRange>
+using validate_context_for = context<contexts::validation, bool, parse_context_for<ItOrRange>>;
+
+template<class Skipper, class ItOrRange, class SeOrRange = ItOrRange>
+using phrase_validate_context_for = context<contexts::validation, bool, phrase_parse_context_for<Skipper, ItOrRange, SeOrRange>>;
+
+namespace detail {
+
+struct validate_fn
+{
+private:
+    template<std::forward_iterator It, std::sentinel_for<It> Se, class Parser, class Skipper>
+    [[nodiscard]] static constexpr parse_result<It, Se>
+    call(It first, Se last, Parser const& p, Skipper& skipper, bool const post_skip)
+    {
+        bool validating = true;
+        expectation_failure<It> expect_failure;
+
+        bool const ok = detail::parse_with_extra_context<contexts::validation>(
+            first, last, p, skipper, unused, post_skip, expect_failure, validating
+        );
+        return parse_result<It, Se>{
+            .ok = ok,
+            .expect_failure = std::move(expect_failure),
+            .remainder = {std::move(first), std::move(last)}
+        };
+    }
+
+public:
+    // It/Se + Parser
+    template<std::forward_iterator It, std::sentinel_for<It> Se, X4Parser<It, Se> Parser>
+    static constexpr parse_result<It, Se>
+    operator()(It first, Se last, Parser&& p)
+    {
+        auto skipper_kind = builtin_skipper_kind::no_skip;
+        return validate_fn::call(std::move(first), std::move(last), as_parser(std::forward<Parser>(p)), skipper_kind, false);
+    }
+
+    // It/Se + Parser + Skipper + (root_skipper_flag)
+    template<std::forward_iterator It, std::sentinel_for<It> Se, X4Parser<It, Se> Parser, X4ExplicitParser<It, Se> Skipper>
+    static constexpr parse_result<It, Se>
+    operator()(It first, Se last, Parser&& p, Skipper const& s, root_skipper_flag flag = root_skipper_flag::do_post_skip)
+    {
+        auto&& maybe_builtin_skipper = to_builtin(s);
+        return validate_fn::call(
+            std::move(first), std::move(last), as_parser(std::forward<Parser>(p)),
+            maybe_builtin_skipper, flag == root_skipper_flag::do_post_skip
+        );
+    }
+
+    // R + Parser
+    template<std::ranges::forward_range R, X4RangeParseParser<R> Parser>
+    static constexpr parse_result_for<R>
+    operator()(R const& range, Parser&& p)
+    {
+        // Treat "str" as `string_view`
+        auto const& range_ = detail::as_parse_range(range);
+        return validate_fn{}(std::ranges::begin(range_), std::ranges::end(range_), std::forward<Parser>(p));
+    }
+
+    // R + Parser + Skipper + (root_skipper_flag)
+    template<std::ranges::forward_range R, X4RangeParseParser<R> Parser, X4RangeParseSkipper<R> Skipper>
+    static constexpr parse_result_for<R>
+    operator()(R const& range, Parser&& p, Skipper const& s, root_skipper_flag flag = root_skipper_flag::do_post_skip)
+    {
+        // Treat "str" as `string_view`
+        auto const& range_ = detail::as_parse_range(range);
+        return validate_fn{}(std::ranges::begin(range_), std::ranges::end(range_), std::forward<Parser>(p), s, flag);
+    }
+};
+
+} // detail
+
+inline namespace cpos {
+
+// `validate(...)` checks whether the input matches the parser, like
+// `parse(...)` with `x4::unused`, but in recognition-only mode (see
+// `x4::contexts::validation`): rules parse their definitions without an
+// attribute and semantic actions are skipped unless wrapped in
+// `x4::required(...)`. No attribute is built, so for the usual grammars
+// nothing is allocated. The result converts to `true` if the whole input
+// matched.
+[[maybe_unused]] inline constexpr detail::validate_fn validate{};
+
+} // cpos
+
+} // iris::x4
+
+#endif
@@ -0,0 +1,115 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/debug/allocation_counter.hpp>
+#include <iris/x4/rule.hpp>
+#include <iris/x4/char/char.hpp>
+#include <iris/x4/directive/with.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/operator/list.hpp>
+#include <iris/x4/operator/plus.hpp>
+
+#include <memory_resource>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("allocation_counter")
+{
+    using x4::rule;
+    using x4::int_;
+    using x4::allocation_counter;
+
+    // Compiled out when no counter is bound
+    STATIC_CHECK(std::is_empty_v<x4::detail::scoped_allocation_rule<x4::parse_context_for<std::string_view>>>);
+    STATIC_CHECK(std::is_empty_v<x4::detail::scoped_container_growth<x4::parse_context_for<std::string_view>, std::vector<int>>>);
+
+    auto const ints = rule<struct ints_id, std::vector<int>>("ints") = int_ % ',';
+    std::string_view const input = "1,2,3,4,5,6,7,8,9";
+
+    {
+        allocation_counter counter;
+        std::vector<int> v;
+        REQUIRE(parse(input, x4::with<x4::contexts::allocation_counter>(counter)[ints], v));
+        REQUIRE(v.size() == 9);
+
+        auto const total = counter.total();
+        CHECK(total.allocations >= 2);
+        CHECK(total.reallocations == total.allocations - 1);
+        CHECK(total.deallocations == total.reallocations);
+        CHECK(total.bytes >= 9 * sizeof(int));
+
+        auto const p = counter.find("ints");
+        REQUIRE(p.has_value());
+        CHECK(p->allocations == total.allocations);
+        CHECK(p->bytes == total.bytes);
+        CHECK(!counter.find("").has_value());
+
+        std::ostringstream os;
+        counter.dump(os);
+        CHECK(os.str().find("ints: ") != std::string::npos);
+
+        counter.clear();
+        CHECK(counter.total().allocations == 0);
+        CHECK(!counter.find("ints").has_value());
+    }
+    {
+        // Reserved in advance
+        allocation_counter counter;
+        std::vector<int> v;
+        v.reserve(16);
+        REQUIRE(parse(input, x4::with<x4::contexts::allocation_counter>(counter)[ints], v));
+        CHECK(counter.total().allocations == 0);
+    }
+    {
+        // Containers allocating from the counter are counted once
+        allocation_counter counter;
+        std::pmr::vector<int> v(&counter);
+        REQUIRE(parse(input, x4::with<x4::contexts::allocation_counter>(counter)[int_ % ','], v));
+        REQUIRE(v.size() == 9);
+        CHECK(counter.total().allocations >= 2);
+        CHECK(counter.total().reallocations == 0);
+        CHECK(counter.total().deallocations == counter.total().allocations - 1);
+        CHECK(counter.find("").has_value());
+    }
+    {
+        // Leaving the small string buffer allocates, but moves out of no
+        // previous allocation
+        allocation_counter counter;
+        std::string s;
+        REQUIRE(parse(std::string_view{"abcdefghijklmnopqrstuvwxyz"}, x4::with<x4::contexts::allocation_counter>(counter)[+x4::char_], s));
+        REQUIRE(s.size() == 26);
+        auto const total = counter.total();
+        CHECK(total.allocations >= 1);
+        CHECK(total.reallocations == total.allocations - 1);
+        CHECK(total.deallocations == total.reallocations);
+    }
+    {
+        // Short strings stay in the small string buffer
+        allocation_counter counter;
+        std::string s;
+        REQUIRE(parse(std::string_view{"abc"}, x4::with<x4::contexts::allocation_counter>(counter)[+x4::char_], s));
+        CHECK(counter.total().allocations == 0);
+    }
+    {
+        allocation_counter counter;
+        {
+            allocation_counter::scoped_default const as_default(counter);
+            CHECK(std::pmr::get_default_resource() == &counter);
+
+            std::pmr::vector<int> v;
+            REQUIRE(parse(input, x4::with<x4::contexts::allocation_counter>(counter)[int_ % ','], v));
+        }
+        CHECK(std::pmr::get_default_resource() == counter.upstream());
+        CHECK(counter.total().allocations >= 2);
+        CHECK(counter.total().deallocations == counter.total().allocations);
+    }
+}
@@ -338,3 +338,37 @@ TEST_CASE("alternative")
         CHECK(parse("abaabb", +('a' >> attr(Foo{}) | 'b' >> attr(int{})), x));
     }
 }
+
+TEST_CASE("alternative in-place variant")
+{
+    using x4::standard::char_;
+    using x4::standard::lit;
+    using x4::int_;
+
+    using attr_type = iris::rvariant<std::string, int>;
+    constexpr auto p = +char_("a-z") >> '!' | int_ | (lit('#') >> int_ | lit('$') >> +char_("a-z"));
+
+    using It = std::string_view::const_iterator;
+    using Ctx = x4::parse_context_for<std::string_view>;
+    STATIC_CHECK(x4::detail::is_transactional_alternative_v<std::remove_const_t<decltype(int_)>, It, It, Ctx, attr_type>);
+    STATIC_CHECK(!x4::detail::is_transactional_alternative_v<std::remove_const_t<decltype(int_)>, It, It, Ctx, int>);
+
+    attr_type v = 7;
+    REQUIRE(parse("ab!", p, v));
+    CHECK(iris::get<std::string>(v) == "ab");
+
+    REQUIRE(parse("42", p, v));
+    CHECK(iris::get<int>(v) == 42);
+
+    REQUIRE(parse("#5", p, v));
+    CHECK(iris::get<int>(v) == 5);
+
+    REQUIRE(parse("$xy", p, v));
+    CHECK(iris::get<std::string>(v) == "xy");
+
+    // failed branches, including partially built ones, leave the attribute untouched
+    v = 7;
+    CHECK(!parse("ab?", p, v));
+    CHECK(!parse("#x", p, v));
+    CHECK(iris::get<int>(v) == 7);
+}
@@ -0,0 +1,93 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/debug/backtrack_heatmap.hpp>
+#include <iris/x4/rule.hpp>
+#include <iris/x4/directive/seek.hpp>
+#include <iris/x4/directive/with.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/operator/alternative.hpp>
+#include <iris/x4/operator/list.hpp>
+#include <iris/x4/operator/sequence.hpp>
+
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("backtrack_heatmap")
+{
+    using x4::rule;
+    using x4::int_;
+
+    {
+        std::string_view const input = "12b";
+        x4::backtrack_heatmap heatmap(input.begin());
+
+        auto const item = rule<struct item_id>("item") = (int_ >> 'a') | (int_ >> 'b');
+        REQUIRE(parse(input, x4::with<x4::contexts::backtrack_heatmap>(heatmap)[item]));
+
+        // "12" is parsed twice: once by the failed `int_ >> 'a'`, and once
+        // more after retrying with the right branch
+        REQUIRE(!heatmap.cells().empty());
+        CHECK(heatmap.cells()[0].starts == 2); // rule entry + retry
+        CHECK(heatmap.cells()[0].discarded_bytes == 2);
+        CHECK(heatmap.total_discarded_bytes() == 2);
+
+        auto const top = heatmap.top_rules(5);
+        REQUIRE(top.size() == 1);
+        CHECK(top[0].rule_name == "item");
+        CHECK(top[0].discarded_bytes == 2);
+
+        std::ostringstream os;
+        heatmap.dump(os);
+        CHECK(os.str().find("2 bytes discarded") != std::string::npos);
+        CHECK(os.str().find("item: 2 bytes") != std::string::npos);
+    }
+    {
+        // With attribute
+        std::string_view const input = "12b";
+        x4::backtrack_heatmap heatmap(input.begin());
+
+        auto const item = rule<struct item_id, int>("item") = (int_ >> 'a') | (int_ >> 'b');
+        int i = 0;
+        REQUIRE(parse(input, x4::with<x4::contexts::backtrack_heatmap>(heatmap)[item], i));
+        CHECK(i == 12);
+        CHECK(heatmap.total_discarded_bytes() == 2);
+    }
+    {
+        // The trailing separator of a list is given back
+        std::string_view const input = "1,2,;";
+        x4::backtrack_heatmap heatmap(input.begin());
+
+        std::vector<int> v;
+        REQUIRE(parse(input, x4::with<x4::contexts::backtrack_heatmap>(heatmap)[int_ % ',' >> ",;"], v));
+        CHECK(v == std::vector<int>{1, 2});
+        REQUIRE(heatmap.cells().size() > 3);
+        CHECK(heatmap.cells()[3].discarded_bytes == 1);
+        CHECK(heatmap.total_discarded_bytes() == 1);
+
+        auto const top = heatmap.top_rules(5);
+        REQUIRE(top.size() == 1);
+        CHECK(top[0].rule_name.empty());
+    }
+    {
+        // Every position tried by `seek` is a start
+        std::string_view const input = "xxx1";
+        x4::backtrack_heatmap heatmap(input.begin());
+
+        REQUIRE(parse(input, x4::with<x4::contexts::backtrack_heatmap>(heatmap)[x4::seek[int_]]));
+        CHECK(heatmap.total_starts() == 4);
+        CHECK(heatmap.total_discarded_bytes() == 0);
+
+        heatmap.clear();
+        CHECK(heatmap.cells().empty());
+        CHECK(heatmap.total_starts() == 0);
+    }
+}
@@ -0,0 +1,137 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/symbols.hpp>
+#include <iris/x4/string/concurrent_lookup.hpp>
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST_CASE("concurrent_symbols")
+{
+    using x4::concurrent_symbols;
+
+    {
+        concurrent_symbols<int> sym = {{"apple", 1}, {"banana", 2}};
+
+        int val = 0;
+        REQUIRE(parse("apple", sym, val));
+        CHECK(val == 1);
+
+        sym.add("cherry", 3);
+        REQUIRE(parse("cherry", sym, val));
+        CHECK(val == 3);
+
+        sym.remove("apple");
+        CHECK(!parse("apple", sym, val));
+    }
+
+    {
+        // a snapshot is unaffected by later updates
+        concurrent_symbols<int> sym = {{"apple", 1}};
+        auto const before = sym.snapshot();
+
+        sym.update([](auto& table) {
+            std::string_view const keys[] = {"banana", "cherry"};
+            int i = 2;
+            for (auto key : keys) {
+                (void)table.add(key.begin(), key.end(), i++);
+            }
+        });
+
+        int count_before = 0;
+        before->for_each([&](auto const&, int) { ++count_before; });
+        CHECK(count_before == 1);
+
+        int count_after = 0;
+        sym.for_each([&](auto const&, int) { ++count_after; });
+        CHECK(count_after == 3);
+
+        // copies share the same lookup
+        concurrent_symbols<int> const copied = sym;
+        sym.clear();
+        CHECK(!parse("banana", copied, x4::unused));
+    }
+
+    {
+        // Lookups go through a snapshot, which keeps the values alive
+        concurrent_symbols<int> sym = {{"apple", 1}};
+        STATIC_CHECK(!requires { sym.find("apple"); });
+        STATIC_CHECK(!requires { std::as_const(sym).find("apple"); });
+        STATIC_CHECK(!requires { sym.at("apple"); });
+
+        auto const snapshot = sym.snapshot();
+        std::string_view const key = "apple";
+        auto first = key.begin();
+        int const* const found = snapshot->find(first, key.end(), x4::case_compare<x4::char_encoding::standard>{});
+        REQUIRE(found != nullptr);
+        CHECK(*found == 1);
+    }
+
+    {
+        // Reassignment publishes the new contents at once
+        concurrent_symbols<int> sym = {{"key0", 0}};
+        std::atomic<bool> done = false;
+        std::atomic<int> failures = 0;
+
+        std::jthread reader([&] {
+            while (!done.load(std::memory_order_relaxed)) {
+                if (!parse("key0", sym, x4::unused)) {
+                    failures.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+
+        for (int i = 0; i < 200; ++i) {
+            sym = {"key0", "key1", "key2"};
+            sym = "key0";
+        }
+        done = true;
+        reader.join();
+
+        CHECK(failures.load() == 0);
+        CHECK(parse("key0", sym, x4::unused));
+        CHECK(!parse("key1", sym, x4::unused));
+    }
+
+    {
+        // readers run while a writer keeps publishing new snapshots
+        concurrent_symbols<int> sym = {{"key0", 0}};
+        std::atomic<bool> done = false;
+        std::atomic<int> failures = 0;
+
+        std::vector<std::jthread> readers;
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&] {
+                while (!done.load(std::memory_order_relaxed)) {
+                    int val = -1;
+                    if (!parse("key0", sym, val) || val != 0) {
+                        failures.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+
+        for (int i = 1; i < 200; ++i) {
+            sym.add("key" + std::to_string(i), i);
+        }
+        done = true;
+        readers.clear();
+
+        CHECK(failures.load() == 0);
+
+        int val = 0;
+        REQUIRE(parse("key199", sym, val));
+        CHECK(val == 199);
+    }
+}
@@ -0,0 +1,103 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/auxiliary/cut.hpp>
+#include <iris/x4/char/char.hpp>
+#include <iris/x4/char/char_class.hpp>
+#include <iris/x4/string/string.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/directive/omit.hpp>
+#include <iris/x4/operator/sequence.hpp>
+#include <iris/x4/operator/alternative.hpp>
+
+#include <iris/alloy/tuple.hpp>
+
+#include <string_view>
+#include <type_traits>
+
+TEST_CASE("cut")
+{
+    using x4::cut;
+    using x4::lit;
+    using x4::int_;
+    using x4::alpha;
+
+    {
+        // elements after the cut are expected
+        constexpr auto p = lit("if") >> cut >> '(' >> int_ >> ')';
+        STATIC_CHECK(std::is_same_v<
+            std::remove_const_t<decltype(p)>,
+            x4::sequence<
+                x4::sequence<
+                    x4::sequence<
+                        x4::sequence<std::remove_const_t<decltype(lit("if"))>, x4::cut_parser>,
+                        x4::expect_directive<x4::literal_char<x4::char_encoding::standard, x4::unused_type>>
+                    >,
+                    x4::expect_directive<std::remove_const_t<decltype(int_)>>
+                >,
+                x4::expect_directive<x4::literal_char<x4::char_encoding::standard, x4::unused_type>>
+            >
+        >);
+
+        int val = 0;
+        REQUIRE(parse("if(42)", p, val));
+        CHECK(val == 42);
+
+        auto const res = parse("if(x)", p, val);
+        CHECK(!res.ok);
+        REQUIRE(res.expect_failure.has_value());
+        CHECK(std::string_view(res.expect_failure.where(), res.remainder.end()) == "x)");
+    }
+    {
+        // the failure before the cut still backtracks
+        constexpr auto p = lit("if") >> cut >> '(' >> int_ >> ')' | lit("i") >> alpha;
+        CHECK(parse("ix", p));
+
+        // the failure after the cut commits the alternative
+        auto const res = parse("if x", p);
+        CHECK(!res.ok);
+        CHECK(res.expect_failure.has_value());
+    }
+    {
+        // without a cut, the alternative is retried
+        constexpr auto p = lit("if") >> '(' | lit("if") >> ' ';
+        CHECK(parse("if ", p));
+    }
+    {
+        // `a > b >> c` is unaffected
+        constexpr auto p = (lit('a') > 'b') >> 'c';
+        STATIC_CHECK(std::is_same_v<
+            std::remove_const_t<decltype(p)>,
+            x4::sequence<
+                x4::sequence<
+                    x4::literal_char<x4::char_encoding::standard, x4::unused_type>,
+                    x4::expect_directive<x4::literal_char<x4::char_encoding::standard, x4::unused_type>>
+                >,
+                x4::literal_char<x4::char_encoding::standard, x4::unused_type>
+            >
+        >);
+    }
+    {
+        // attributes are unchanged by the cut
+        constexpr auto p = int_ >> cut >> ',' >> int_;
+        alloy::tuple<int, int> attr;
+        REQUIRE(parse("1,2", p, attr));
+        CHECK(alloy::get<0>(attr) == 1);
+        CHECK(alloy::get<1>(attr) == 2);
+    }
+    {
+        // only the sequence containing the cut is committed
+        constexpr auto p = x4::omit[lit("if") >> cut >> '(' >> int_ >> ')'] >> ';' | lit("if(1)") >> alpha;
+        CHECK(parse("if(1);", p));
+        CHECK(parse("if(1)x", p));
+        CHECK(parse("if(x);", p).expect_failure.has_value());
+    }
+
+    CHECK(x4::what(cut) == "cut");
+}
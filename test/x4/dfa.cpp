@@ -0,0 +1,107 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/directive/dfa.hpp>
+#include <iris/x4/directive/lexeme.hpp>
+#include <iris/x4/directive/no_case.hpp>
+#include <iris/x4/directive/raw.hpp>
+#include <iris/x4/char/char.hpp>
+#include <iris/x4/char/char_class.hpp>
+#include <iris/x4/string/string.hpp>
+#include <iris/x4/operator/sequence.hpp>
+#include <iris/x4/operator/alternative.hpp>
+#include <iris/x4/operator/kleene.hpp>
+#include <iris/x4/operator/plus.hpp>
+#include <iris/x4/operator/optional.hpp>
+#include <iris/x4/operator/difference.hpp>
+#include <iris/x4/operator/list.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("dfa")
+{
+    using x4::dfa;
+    using x4::lexeme;
+    using x4::raw;
+    using x4::lit;
+    using x4::alpha;
+    using x4::alnum;
+    using x4::digit;
+    using x4::char_;
+
+    {
+        auto const ident = dfa[alpha >> *(alnum | '_')];
+        CHECK(parse("abc_12", ident));
+        CHECK(parse("a", ident));
+        CHECK(!parse("1abc", ident));
+        CHECK(!parse("", ident));
+
+        auto const res = parse("abc_12+x", ident);
+        CHECK(res.is_partial_match());
+        CHECK(std::string_view(res.remainder.begin(), res.remainder.end()) == "+x");
+
+        // same tokens as the recursive-descent version
+        auto const rd = lexeme[alpha >> *(alnum | '_')];
+        for (std::string_view const input : {"x", "x1_", "_x", "9", "ab cd", "Z9z"}) {
+            auto const expected = parse(input, rd, x4::space);
+            auto const actual = parse(input, ident, x4::space);
+            CHECK(expected.ok == actual.ok);
+            CHECK(expected.remainder.begin() == actual.remainder.begin());
+        }
+
+        // the minimized automaton: dead, start, and a single accepting state
+        CHECK(ident.states() == 3);
+    }
+    {
+        // numeric literal shape
+        auto const number = dfa[-lit('-') >> +digit >> -('.' >> +digit) >> -((lit('e') | 'E') >> -(lit('+') | '-') >> +digit)];
+        for (std::string_view const input : {"0", "-12", "3.25", "1e10", "6.02E+23", "-1.5e-3"}) {
+            CHECK(parse(input, number));
+        }
+        CHECK(!parse("-", number));
+        CHECK(!parse(".5", number));
+
+        // longest match, without consuming an incomplete exponent
+        auto const res = parse("12.5e+x", number);
+        CHECK(res.is_partial_match());
+        CHECK(std::string_view(res.remainder.begin(), res.remainder.end()) == "e+x");
+    }
+    {
+        // quoted string shape
+        auto const quoted = dfa['"' >> *((char_ - '"' - '\\') | ('\\' >> char_)) >> '"'];
+        CHECK(parse(R"("abc")", quoted));
+        CHECK(parse(R"("a\"b\\")", quoted));
+        CHECK(!parse(R"("abc)", quoted));
+        CHECK(!parse(R"("a\")", quoted));
+
+        std::string str;
+        REQUIRE(parse(R"(  "x y" rest)", raw[quoted], x4::space, str).is_partial_match());
+        CHECK(str == R"("x y")");
+    }
+    {
+        auto const kw = dfa[lit("select") | "set"];
+        CHECK(parse("SELECT", x4::no_case[kw]));
+        CHECK(!parse("SELECT", kw));
+        CHECK(parse("Set", dfa[x4::no_case[lit("set")]]));
+    }
+    {
+        // longest match rather than ordered choice
+        CHECK(parse("ab", dfa[lit('a') | "ab"]));
+        CHECK(!parse("ab", lit('a') | "ab"));
+    }
+    {
+        std::vector<std::string> idents;
+        REQUIRE(parse("a1, b_2 ,c", raw[dfa[alpha >> *(alnum | '_')]] % ',', x4::space, idents));
+        CHECK(idents == std::vector<std::string>{"a1", "b_2", "c"});
+    }
+
+    CHECK(x4::what(dfa[lit("ab")]) == "dfa[\"ab\"]");
+}
@@ -0,0 +1,131 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/debug/flight_recorder.hpp>
+#include <iris/x4/rule.hpp>
+#include <iris/x4/directive/with.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/operator/sequence.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+TEST_CASE("flight_recorder")
+{
+    using x4::rule;
+    using x4::int_;
+    using kind = x4::flight_event_kind;
+    using It = std::string_view::const_iterator;
+
+    STATIC_CHECK(std::is_empty_v<x4::detail::scoped_flight_recording<struct any_id, x4::parse_context_for<std::string_view>, It>>);
+
+    auto const num = rule<struct num_id, int>("num") = int_;
+    auto const pair = rule<struct pair_id>("pair") = num >> ',' >> num;
+
+    {
+        std::string_view const input = "1,2";
+        x4::flight_recorder<It> recorder(8);
+        recorder.set_input(input.begin());
+
+        REQUIRE(parse(input, x4::with<x4::contexts::flight_recorder>(recorder)[pair]));
+
+        REQUIRE(recorder.size() == 6);
+        CHECK(recorder.dropped() == 0);
+        REQUIRE(recorder.rule_names().size() == 2);
+        CHECK(recorder.rule_names()[0] == "pair");
+        CHECK(recorder.rule_names()[1] == "num");
+
+        auto const events = recorder.events();
+        CHECK(events[0].kind == kind::enter);
+        CHECK(events[0].rule == 0);
+        CHECK(events[1].kind == kind::enter);
+        CHECK(events[1].rule == 1);
+        CHECK(events[2].kind == kind::succeed);
+        CHECK(events[2].offset == 1);
+        CHECK(events[3].offset == 2);
+        CHECK(events[5].kind == kind::succeed);
+        CHECK(events[5].rule == 0);
+        CHECK(events[5].offset == 3);
+        for (std::size_t i = 1; i < events.size(); ++i) {
+            CHECK(events[i - 1].ticks <= events[i].ticks);
+        }
+
+        std::ostringstream os;
+        recorder.write_chrome_trace(os);
+        CHECK(os.str().starts_with("{\"traceEvents\":["));
+        CHECK(os.str().find("\"name\":\"pair\",\"ph\":\"B\"") != std::string::npos);
+        CHECK(os.str().find("\"ok\":true") != std::string::npos);
+    }
+    {
+        // Only the most recent events are kept
+        std::string_view const input = "1,2";
+        x4::flight_recorder<It> recorder(4);
+        recorder.set_input(input.begin());
+
+        REQUIRE(parse(input, x4::with<x4::contexts::flight_recorder>(recorder)[pair]));
+        CHECK(recorder.size() == 4);
+        CHECK(recorder.dropped() == 2);
+
+        auto const events = recorder.events();
+        CHECK(events.front().kind == kind::succeed);
+        CHECK(events.front().offset == 1);
+        CHECK(events.back().rule == 0);
+
+        // Exits whose entry was overwritten are not exported
+        std::ostringstream os;
+        recorder.write_chrome_trace(os);
+        std::string const json = os.str();
+        CHECK(json.find("\"ph\":\"B\"") != std::string::npos);
+        CHECK(json.find("\"name\":\"pair\"") == std::string::npos);
+
+        recorder.clear();
+        CHECK(recorder.size() == 0);
+        CHECK(recorder.events().empty());
+    }
+    {
+        std::string_view const input = "1;";
+        x4::flight_recorder<It> recorder(16);
+        recorder.set_input(input.begin());
+
+        REQUIRE(!parse(input, x4::with<x4::contexts::flight_recorder>(recorder)[pair]));
+        auto const events = recorder.events();
+        REQUIRE(events.size() == 4);
+        CHECK(events.back().kind == kind::fail);
+        CHECK(events.back().rule == 0);
+
+        std::ostringstream os;
+        recorder.write_chrome_trace(os);
+        CHECK(os.str().find("\"ok\":false") != std::string::npos);
+    }
+    {
+        // Timestamps keep their precision past one second
+        auto const ts = [](std::uint64_t const ticks, double const ticks_per_microsecond) {
+            std::ostringstream os;
+            x4::detail::write_trace_timestamp(os, ticks, ticks_per_microsecond);
+            return os.str();
+        };
+        CHECK(ts(0, 1.0) == "0.000");
+        CHECK(ts(123456789, 1.0) == "123456789.000");
+        CHECK(ts(123456789, 1000.0) == "123456.789");
+        CHECK(ts(9876543210123, 1.0) == "9876543210123.000");
+
+        std::string_view const input = "1,2";
+        x4::flight_recorder<It> recorder(8);
+        recorder.set_input(input.begin());
+        REQUIRE(parse(input, x4::with<x4::contexts::flight_recorder>(recorder)[pair]));
+
+        std::ostringstream os;
+        recorder.write_chrome_trace(os, 1e-9);
+        CHECK(os.str().find("\"ts\":0.000,") != std::string::npos);
+        CHECK(os.str().find("e+") == std::string::npos);
+    }
+}
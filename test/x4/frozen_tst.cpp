@@ -0,0 +1,194 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/string/frozen_tst.hpp>
+#include <iris/x4/string/tst.hpp>
+#include <iris/x4/string/case_compare.hpp>
+#include <iris/x4/symbols.hpp>
+#include <iris/x4/directive/no_case.hpp>
+
+#include <iris/x4/char_encoding/standard.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <utility>
+
+namespace {
+
+using frozen_lookup = x4::frozen_tst<char, int>;
+
+std::vector<std::byte> make_fruits()
+{
+    x4::frozen_tst_builder<char, int> builder;
+    builder.add("pineapple", 1);
+    builder.add("orange", 2);
+    builder.add("banana", 3);
+    builder.add("applepie", 4);
+    builder.add("apple", 5);
+    builder.add("apple", 42); // first one wins
+    builder.add("", 0); // ignored
+    return builder.build();
+}
+
+int const* find(frozen_lookup const& lookup, std::string_view s, std::size_t expected_len = std::string_view::npos)
+{
+    auto first = s.begin();
+    int const* res = lookup.find(first, s.end(), x4::case_compare<x4::char_encoding::standard>{});
+    if (res && expected_len != std::string_view::npos) {
+        CHECK(static_cast<std::size_t>(first - s.begin()) == expected_len);
+    }
+    return res;
+}
+
+} // anonymous
+
+TEST_CASE("frozen_tst")
+{
+    std::vector<std::byte> const image = make_fruits();
+
+    {
+        auto const lookup = frozen_lookup::load(image);
+        REQUIRE(lookup.has_value());
+        CHECK(lookup->verify());
+        CHECK(lookup->size() == 5);
+
+        REQUIRE(find(*lookup, "pineapple", 9));
+        CHECK(*find(*lookup, "pineapple") == 1);
+        CHECK(*find(*lookup, "orange", 6) == 2);
+        CHECK(*find(*lookup, "banana", 6) == 3);
+        CHECK(*find(*lookup, "applepie", 8) == 4);
+        CHECK(*find(*lookup, "apple", 5) == 5);
+        CHECK(*find(*lookup, "applepi", 5) == 5);
+        CHECK(*find(*lookup, "bananarama", 6) == 3);
+        CHECK(!find(*lookup, "appl"));
+        CHECK(!find(*lookup, "pizza"));
+        CHECK(!find(*lookup, ""));
+    }
+
+    {
+        // round trip through a regular tst
+        x4::tst<char, int> t;
+        std::string_view const keys[] = {"one", "two", "three", "thirty"};
+        int i = 1;
+        for (auto key : keys) {
+            (void)t.add(key.begin(), key.end(), i++);
+        }
+
+        x4::frozen_tst_builder<char, int> builder;
+        builder.add(t);
+        auto const bytes = builder.build();
+        auto const lookup = frozen_lookup::load(bytes);
+        REQUIRE(lookup.has_value());
+
+        std::vector<std::pair<std::string, int>> from_tst, from_frozen;
+        t.for_each([&](std::string const& key, int val) { from_tst.emplace_back(key, val); });
+        lookup->for_each([&](std::string const& key, int val) { from_frozen.emplace_back(key, val); });
+        std::ranges::sort(from_tst);
+        std::ranges::sort(from_frozen);
+        CHECK(from_tst == from_frozen);
+    }
+
+    {
+        // the image is position-independent
+        std::vector<std::byte> copy(image.size());
+        std::memcpy(copy.data(), image.data(), image.size());
+        auto const lookup = frozen_lookup::load(copy);
+        REQUIRE(lookup.has_value());
+        CHECK(*find(*lookup, "orange") == 2);
+    }
+
+    {
+        // malformed images are rejected
+        CHECK(!frozen_lookup::load({}));
+        CHECK(!frozen_lookup::load(std::span(image).first(image.size() - 1)));
+        CHECK(!x4::frozen_tst<char, long long>::load(image));
+        CHECK(!x4::frozen_tst<wchar_t, int>::load(image));
+
+        std::vector<std::byte> corrupt = image;
+        corrupt[0] = std::byte{0};
+        CHECK(!frozen_lookup::load(corrupt));
+    }
+
+    {
+        // a link cycle is in range, but rejected by `verify`
+        x4::detail::frozen_tst_header h;
+        std::memcpy(&h, image.data(), sizeof(h));
+
+        std::vector<std::byte> cyclic = image;
+        x4::detail::frozen_tst_node root;
+        std::memcpy(&root, cyclic.data() + h.nodes_offset, sizeof(root));
+        root.lt = 0;
+        std::memcpy(cyclic.data() + h.nodes_offset, &root, sizeof(root));
+
+        auto const lookup = frozen_lookup::load(cyclic);
+        REQUIRE(lookup.has_value());
+        CHECK(!lookup->verify());
+    }
+
+    {
+        // empty image
+        auto const bytes = x4::frozen_tst_builder<char, int>{}.build();
+        auto const lookup = frozen_lookup::load(bytes);
+        REQUIRE(lookup.has_value());
+        CHECK(lookup->empty());
+        CHECK(!find(*lookup, "apple"));
+    }
+
+    {
+        // as a symbols lookup
+        using symbols_type = x4::unique_symbols_parser<x4::char_encoding::standard, int, frozen_lookup>;
+        symbols_type const sym(*frozen_lookup::load(image), "fruits");
+        CHECK(sym.name() == "fruits");
+
+        int val = 0;
+        REQUIRE(parse("banana", sym, val));
+        CHECK(val == 3);
+        REQUIRE(parse("applepie", sym, val));
+        CHECK(val == 4);
+        CHECK(!parse("pizza", sym, val));
+
+        REQUIRE(parse("ORANGE", x4::no_case[sym], val));
+        CHECK(val == 2);
+
+        CHECK(sym.find("apple") != nullptr);
+        CHECK(sym.find("applet") == nullptr);
+
+        // The values are read-only, even through a non-const parser
+        symbols_type mutable_sym(*frozen_lookup::load(image));
+        STATIC_CHECK(std::is_same_v<decltype(mutable_sym.find("apple")), int const*>);
+        REQUIRE(mutable_sym.find("apple") != nullptr);
+        CHECK(*mutable_sym.find("apple") == 5);
+
+        std::string_view const input = "orangeade";
+        auto first = input.begin();
+        int const* const found = mutable_sym.prefix_find(first, input.end());
+        REQUIRE(found != nullptr);
+        CHECK(*found == 2);
+        CHECK(first - input.begin() == 6);
+
+        symbols_type const copied = sym;
+        REQUIRE(parse("pineapple", copied, val));
+        CHECK(val == 1);
+    }
+
+    {
+        using symbols_type = x4::shared_symbols_parser<x4::char_encoding::standard, int, frozen_lookup>;
+        symbols_type const sym(*frozen_lookup::load(image));
+        symbols_type const shared = sym;
+
+        int val = 0;
+        REQUIRE(parse("orange", shared, val));
+        CHECK(val == 2);
+    }
+}
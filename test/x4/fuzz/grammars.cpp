@@ -0,0 +1,110 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_fuzz.hpp"
+
+#include <iris/x4/rule.hpp>
+#include <iris/x4/char/char.hpp>
+#include <iris/x4/char/char_class.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/numeric/uint.hpp>
+#include <iris/x4/operator/alternative.hpp>
+#include <iris/x4/operator/kleene.hpp>
+#include <iris/x4/operator/list.hpp>
+#include <iris/x4/operator/sequence.hpp>
+
+#include <iris/rvariant/rvariant.hpp>
+#include <iris/rvariant/recursive_wrapper.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Grammars representative of test/x4/grammar.cpp, recursive.cpp, rule3.cpp
+// and expect.cpp. The first byte of the input selects the grammar, and the
+// rest is parsed.
+
+namespace {
+
+// test/x4/grammar.cpp
+x4::rule<struct int_grammar_r, int> const int_grammar("int_grammar");
+
+auto const int_grammar_def = x4::int_;
+
+IRIS_X4_DEFINE(int_grammar)
+
+// test/x4/rule3.cpp
+struct node_array;
+
+using node_t = iris::rvariant<
+    int,
+    iris::recursive_wrapper<node_array>
+>;
+
+struct node_array : std::vector<node_t>
+{
+    using std::vector<node_t>::vector;
+};
+
+x4::rule<struct nested_r, node_t> const nested("nested");
+
+auto const nested_def = '[' >> nested % ',' >> ']' | x4::int_;
+
+IRIS_X4_DEFINE(nested)
+
+// Arithmetic expressions, with expectations as in test/x4/expect.cpp
+x4::rule<struct expr_r> const expr("expr");
+x4::rule<struct term_r> const term("term");
+x4::rule<struct factor_r> const factor("factor");
+
+auto const expr_def = term >> *(('+' > term) | ('-' > term));
+auto const term_def = factor >> *(('*' > factor) | ('/' > factor));
+auto const factor_def = x4::uint_ | ('(' > expr > ')') | ('-' > factor) | ('+' > factor);
+
+IRIS_X4_DEFINE(expr)
+IRIS_X4_DEFINE(term)
+IRIS_X4_DEFINE(factor)
+
+} // anonymous
+
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* data, std::size_t size)
+{
+    if (size == 0) return 0;
+    std::uint8_t const selector = data[0];
+    ++data;
+    --size;
+
+    switch (selector % 4) {
+    case 0:
+        x4_fuzz::run_within_budget("int_grammar", data, size, [](auto first, auto last) {
+            int attr = 0;
+            (void)x4::parse(first, last, int_grammar, attr);
+        });
+        break;
+
+    case 1: // test/x4/recursive.cpp
+        x4_fuzz::run_within_budget("(int_ % '-') % ','", data, size, [](auto first, auto last) {
+            std::vector<int> attr;
+            (void)x4::parse(first, last, (x4::int_ % '-') % ',', attr);
+        });
+        break;
+
+    case 2:
+        x4_fuzz::run_within_budget("nested", data, size, [](auto first, auto last) {
+            node_t attr;
+            (void)x4::parse(first, last, nested, attr);
+        });
+        break;
+
+    case 3:
+        x4_fuzz::run_within_budget("expr", data, size, [](auto first, auto last) {
+            (void)x4::parse(first, last, expr, x4::standard::space, x4::unused);
+        });
+        break;
+    }
+    return 0;
+}
@@ -0,0 +1,143 @@
+#ifndef IRIS_X4_TEST_FUZZ_IRIS_X4_FUZZ_HPP
+#define IRIS_X4_TEST_FUZZ_IRIS_X4_FUZZ_HPP
+
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <iris/x4/parse.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <string_view>
+
+namespace x4 = iris::x4;
+
+namespace x4_fuzz {
+
+// Aborts the parse once the number of iterator steps exceeds
+//
+//     IRIS_X4_FUZZ_BASE_STEPS + IRIS_X4_FUZZ_STEPS_PER_BYTE * input size
+//
+// so that libFuzzer reports the input as a crash and keeps it. Both can be
+// overridden by the environment variables of the same name.
+struct work_budget
+{
+    std::uint64_t base_steps = 1024;
+    std::uint64_t steps_per_byte = 256;
+
+    [[nodiscard]] static work_budget const& get()
+    {
+        static work_budget const budget = [] {
+            work_budget b;
+            if (char const* s = std::getenv("IRIS_X4_FUZZ_BASE_STEPS")) b.base_steps = std::strtoull(s, nullptr, 10);
+            if (char const* s = std::getenv("IRIS_X4_FUZZ_STEPS_PER_BYTE")) b.steps_per_byte = std::strtoull(s, nullptr, 10);
+            return b;
+        }();
+        return budget;
+    }
+};
+
+struct step_counter
+{
+    char const* target_name = "";
+    std::size_t input_size = 0;
+    std::uint64_t steps = 0;
+    std::uint64_t limit = 0;
+
+    void step()
+    {
+        if (++steps > limit) [[unlikely]] this->exceeded();
+    }
+
+    [[noreturn]] void exceeded() const
+    {
+        std::fprintf(
+            stderr,
+            "%s: work budget exceeded: more than %llu steps for %zu bytes of input\n",
+            target_name, static_cast<unsigned long long>(limit), input_size
+        );
+        std::abort();
+    }
+};
+
+// A forward iterator over the fuzzer input which counts each dereference and
+// increment as one step. This measures the work of every parser, including
+// the input which is read again after backtracking.
+class counting_iterator
+{
+public:
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = char;
+    using difference_type = std::ptrdiff_t;
+    using reference = char const&;
+
+    counting_iterator() = default;
+
+    counting_iterator(char const* p, step_counter* counter) noexcept
+        : p_(p)
+        , counter_(counter)
+    {}
+
+    reference operator*() const
+    {
+        counter_->step();
+        return *p_;
+    }
+
+    counting_iterator& operator++()
+    {
+        counter_->step();
+        ++p_;
+        return *this;
+    }
+
+    counting_iterator operator++(int)
+    {
+        counting_iterator tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    [[nodiscard]] friend bool operator==(counting_iterator const& a, counting_iterator const& b) noexcept
+    {
+        return a.p_ == b.p_;
+    }
+
+    [[nodiscard]] char const* base() const noexcept { return p_; }
+
+private:
+    char const* p_ = nullptr;
+    step_counter* counter_ = nullptr;
+};
+
+static_assert(std::forward_iterator<counting_iterator>);
+
+// Calls `f(first, last)` with counting iterators over `[data, data + size)`,
+// aborting if it exceeds the work budget. Returns the number of steps.
+template<class F>
+std::uint64_t run_within_budget(char const* target_name, std::uint8_t const* data, std::size_t size, F&& f)
+{
+    auto const& budget = work_budget::get();
+    step_counter counter{
+        .target_name = target_name,
+        .input_size = size,
+        .steps = 0,
+        .limit = budget.base_steps + budget.steps_per_byte * size,
+    };
+
+    auto const* const chars = reinterpret_cast<char const*>(data);
+    f(counting_iterator(chars, &counter), counting_iterator(chars + size, &counter));
+    return counter.steps;
+}
+
+} // x4_fuzz
+
+#endif
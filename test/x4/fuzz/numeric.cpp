@@ -0,0 +1,66 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_fuzz.hpp"
+
+#include <iris/x4/numeric/bool.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/numeric/real.hpp>
+#include <iris/x4/numeric/uint.hpp>
+#include <iris/x4/operator/list.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+template<class Parser, class Attr>
+void parse_numeric(char const* name, std::uint8_t const* data, std::size_t size, Parser const& p, Attr& attr)
+{
+    x4_fuzz::run_within_budget(name, data, size, [&](auto first, auto last) {
+        (void)x4::parse(first, last, p, attr);
+    });
+}
+
+} // anonymous
+
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* data, std::size_t size)
+{
+    {
+        int attr = 0;
+        parse_numeric("int_", data, size, x4::int_, attr);
+    }
+    {
+        std::int64_t attr = 0;
+        parse_numeric("int64", data, size, x4::int64, attr);
+    }
+    {
+        std::uint8_t attr = 0;
+        parse_numeric("uint8", data, size, x4::uint8, attr);
+    }
+    {
+        unsigned attr = 0;
+        parse_numeric("uint_", data, size, x4::uint_, attr);
+        parse_numeric("bin", data, size, x4::bin, attr);
+        parse_numeric("oct", data, size, x4::oct, attr);
+        parse_numeric("hex", data, size, x4::hex, attr);
+    }
+    {
+        double attr = 0;
+        parse_numeric("double_", data, size, x4::double_, attr);
+    }
+    {
+        bool attr = false;
+        parse_numeric("bool_", data, size, x4::bool_, attr);
+    }
+    {
+        std::vector<double> attr;
+        parse_numeric("double_ % ','", data, size, x4::double_ % ',', attr);
+    }
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_fuzz.hpp"
+
+#include <iris/x4/symbols.hpp>
+#include <iris/x4/string/tst.hpp>
+#include <iris/x4/string/case_compare.hpp>
+#include <iris/x4/char/char.hpp>
+#include <iris/x4/directive/no_case.hpp>
+#include <iris/x4/operator/alternative.hpp>
+#include <iris/x4/operator/kleene.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// The input is a list of keywords separated by "\n", then "\n\n", then the
+// text to look them up in. Keywords are truncated to `max_keyword_length`:
+// looking up a keyword reads up to its length at each position of the
+// text, which is linear only for keywords of bounded length.
+
+namespace {
+
+constexpr std::size_t max_keyword_length = 32;
+
+struct split_input
+{
+    std::vector<std::string_view> keywords;
+    std::uint8_t const* text = nullptr;
+    std::size_t text_size = 0;
+};
+
+split_input split(std::uint8_t const* data, std::size_t size)
+{
+    std::string_view const input(reinterpret_cast<char const*>(data), size);
+    std::size_t const separator = input.find("\n\n");
+    std::string_view keywords = input.substr(0, separator);
+
+    split_input result;
+    if (separator != std::string_view::npos) {
+        result.text = data + separator + 2;
+        result.text_size = size - separator - 2;
+    }
+
+    while (!keywords.empty()) {
+        std::size_t const eol = keywords.find('\n');
+        std::string_view const keyword = keywords.substr(0, eol);
+        if (!keyword.empty()) result.keywords.push_back(keyword.substr(0, max_keyword_length));
+        if (eol == std::string_view::npos) break;
+        keywords.remove_prefix(eol + 1);
+    }
+    return result;
+}
+
+} // anonymous
+
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* data, std::size_t size)
+{
+    auto const input = split(data, size);
+
+    {
+        x4::tst<char, int> lookup;
+        for (std::size_t i = 0; i < input.keywords.size(); ++i) {
+            (void)lookup.add(input.keywords[i].begin(), input.keywords[i].end(), static_cast<int>(i));
+        }
+        for (std::size_t i = 0; i < input.keywords.size(); i += 2) {
+            lookup.remove(input.keywords[i].begin(), input.keywords[i].end());
+        }
+
+        x4_fuzz::run_within_budget("tst", input.text, input.text_size, [&](auto first, auto last) {
+            x4::case_compare<x4::char_encoding::standard> const compare;
+            while (first != last) {
+                auto it = first;
+                if (!lookup.find(it, last, compare) || it == first) ++first;
+                else first = it;
+            }
+        });
+    }
+
+    {
+        x4::shared_symbols<int> sym;
+        for (std::size_t i = 0; i < input.keywords.size(); ++i) {
+            sym.add(input.keywords[i], static_cast<int>(i));
+        }
+
+        x4_fuzz::run_within_budget("symbols", input.text, input.text_size, [&](auto first, auto last) {
+            (void)x4::parse(first, last, *(sym | x4::standard::char_), x4::unused);
+        });
+        x4_fuzz::run_within_budget("no_case[symbols]", input.text, input.text_size, [&](auto first, auto last) {
+            (void)x4::parse(first, last, *(x4::no_case[sym] | x4::standard::char_), x4::unused);
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/ast/line_index.hpp>
+#include <iris/x4/ast/position_tagged.hpp>
+
+#include <forward_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// The line counting of `default_error_handler` before the index existed
+template<class It>
+std::size_t scan_line_number(It first, It pos)
+{
+    std::size_t line = 1;
+    char prev = 0;
+    for (; first != pos; ++first) {
+        char const c = *first;
+        if (c == '\r' || (c == '\n' && prev != '\r')) ++line;
+        prev = c;
+    }
+    return line;
+}
+
+template<class It>
+It scan_line_start(It first, It pos)
+{
+    It latest = first;
+    for (It i = first; i != pos;) {
+        if (*i == '\r' || *i == '\n') {
+            latest = ++i;
+        } else {
+            ++i;
+        }
+    }
+    return latest;
+}
+
+} // anonymous
+
+TEST_CASE("line_index")
+{
+    using x4::ast::line_index;
+
+    {
+        std::string_view const input = "ab\ncd\n\nef";
+        line_index index(input.begin(), input.end());
+
+        CHECK(index.line_count() == 4);
+        CHECK(index.line_number(input.begin()) == 1);
+        CHECK(index.line_number(input.begin() + 2) == 1); // "\n"
+        CHECK(index.line_number(input.begin() + 3) == 2);
+        CHECK(index.line_number(input.begin() + 6) == 3);
+        CHECK(index.line_number(input.end()) == 4);
+
+        CHECK(index.line_start(input.begin() + 4) == input.begin() + 3);
+        CHECK(std::string_view(index.line(2).begin(), index.line(2).end()) == "cd");
+        CHECK(index.line(3).empty());
+        CHECK(std::string_view(index.line(4).begin(), index.line(4).end()) == "ef");
+        CHECK(index.line(5).empty());
+    }
+    {
+        // Tab expansion
+        std::string_view const input = "x\n\tab";
+        line_index index(input.begin(), input.end());
+
+        auto const pos = index.position(input.begin() + 4, 4);
+        CHECK(pos.line == 2);
+        CHECK(pos.column == 6);
+        CHECK(index.position(input.begin() + 4, 8).column == 10);
+    }
+    {
+        // Same results as scanning, for every kind of line break
+        for (std::string_view const input : {
+            std::string_view{"a\r\nb\rc\nd\r\n\r\ne\n\rf"},
+            std::string_view{"\r\n"},
+            std::string_view{"\n\n"},
+            std::string_view{"\r"},
+            std::string_view{""},
+            std::string_view{"no break"},
+        }) {
+            line_index index(input.begin(), input.end());
+            for (auto it = input.begin(); ; ++it) {
+                CHECK(index.line_number(it) == scan_line_number(input.begin(), it));
+                CHECK(index.line_start(it) == scan_line_start(input.begin(), it));
+                if (it == input.end()) break;
+            }
+        }
+    }
+    {
+        // Forward iterators
+        std::string_view const str = "a\r\nb\nc";
+        std::forward_list<char> const input(str.begin(), str.end());
+        line_index index(input.begin(), input.end());
+
+        for (auto it = input.begin(); ; ++it) {
+            CHECK(index.line_number(it) == scan_line_number(input.begin(), it));
+            CHECK(index.line_start(it) == scan_line_start(input.begin(), it));
+            if (it == input.end()) break;
+        }
+    }
+    {
+        std::string const input = "one\ntwo";
+        x4::ast::position_cache<std::vector<std::string::const_iterator>> cache(input.begin(), input.end());
+        CHECK(cache.lines().line_number(input.begin() + 5) == 2);
+    }
+}
@@ -0,0 +1,114 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/ast/offset_position_cache.hpp>
+#include <iris/x4/ast/position_tagged.hpp>
+#include <iris/x4/debug/default_error_handler.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+struct node : x4::ast::position_tagged
+{
+    int value = 0;
+};
+
+} // anonymous
+
+TEST_CASE("offset_position_cache")
+{
+    using x4::ast::offset_position_cache;
+
+    std::string_view const input = "foo bar\nbaz";
+    using It = std::string_view::const_iterator;
+
+    {
+        offset_position_cache<It> cache(input.begin(), input.end());
+        CHECK(cache.size() == 0);
+
+        node a, b;
+        cache.annotate(a, input.begin(), input.begin() + 3);
+        cache.annotate(b, input.begin() + 8, input.end());
+
+        CHECK(cache.size() == 2);
+        CHECK(a.id_first == 0);
+        CHECK(a.id_last == 0);
+        CHECK(b.id_first == 1);
+        CHECK(b.id_last == 1);
+
+        auto const pa = cache.position_of(a);
+        CHECK(std::string_view(pa.begin(), pa.end()) == "foo");
+        auto const pb = cache.position_of(b);
+        CHECK(std::string_view(pb.begin(), pb.end()) == "baz");
+
+        CHECK(cache.first_offsets() == std::vector<std::uint32_t>{0, 8});
+        CHECK(cache.last_offsets() == std::vector<std::uint32_t>{3, 11});
+
+        CHECK(cache.lines().line_number(pb.begin()) == 2);
+    }
+    {
+        // Nodes not inheriting from position_tagged are not recorded
+        offset_position_cache<It> cache(input.begin(), input.end());
+        int i = 0;
+        cache.annotate(i, input.begin(), input.end());
+        CHECK(cache.size() == 0);
+        CHECK(cache.position_of(i).empty());
+    }
+    {
+        // Ids allocated up front can be filled in any order
+        offset_position_cache<It, std::uint64_t> cache(input.begin(), input.end());
+        cache.reserve_by_input(4);
+
+        node a, b, c;
+        std::size_t const id = cache.allocate(3);
+        CHECK(id == 0);
+        CHECK(cache.size() == 3);
+
+        cache.annotate_at(c, id + 2, input.begin() + 8, input.end());
+        cache.annotate_at(a, id + 0, input.begin(), input.begin() + 3);
+        cache.annotate_at(b, id + 1, input.begin() + 4, input.begin() + 7);
+
+        auto const pa = cache.position_of(a);
+        CHECK(std::string_view(pa.begin(), pa.end()) == "foo");
+        auto const pb = cache.position_of(b);
+        CHECK(std::string_view(pb.begin(), pb.end()) == "bar");
+        auto const pc = cache.position_of(c);
+        CHECK(std::string_view(pc.begin(), pc.end()) == "baz");
+
+        node d;
+        cache.annotate(d, input.begin() + 4, input.begin() + 4);
+        CHECK(d.id_first == 3);
+        CHECK(cache.position_of(d).empty());
+    }
+    {
+        // The input must fit in the offset type
+        std::string const big(300, 'x');
+        using BigIt = std::string::const_iterator;
+        CHECK_THROWS_AS((offset_position_cache<BigIt, std::uint8_t>(big.begin(), big.end())), std::length_error);
+        CHECK_NOTHROW((offset_position_cache<BigIt, std::uint16_t>(big.begin(), big.end())));
+    }
+    {
+        // Usable as the position cache of `default_error_handler`
+        std::ostringstream os;
+        x4::default_error_handler<It, offset_position_cache<It>> handler(input.begin(), input.end(), os);
+
+        node n;
+        handler.on_success(input.begin(), input.begin() + 3, x4::unused, n);
+        CHECK(n.id_first == 0);
+
+        handler.on_expectation_failure(input.begin(), input.end(), x4::unused, x4::expectation_failure<It>(input.begin() + 8, "'x'"));
+        CHECK(os.str().find("line 2") != std::string::npos);
+    }
+}
@@ -0,0 +1,142 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/operator/operator_precedence.hpp>
+#include <iris/x4/operator/sequence.hpp>
+#include <iris/x4/directive/expect.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/char/char.hpp>
+#include <iris/x4/char/char_class.hpp>
+
+#include <string>
+#include <string_view>
+
+namespace {
+
+std::string binary(std::string_view op, std::string const& lhs, std::string const& rhs)
+{
+    return "(" + lhs + std::string(op) + rhs + ")";
+}
+
+x4::operator_table<std::string> make_table()
+{
+    using x4::assoc;
+
+    return x4::operator_table<std::string>{}
+        .infix("||", 1, assoc::left, [](std::string l, std::string r) { return binary("||", l, r); })
+        .infix("<", 5, assoc::none, [](std::string l, std::string r) { return binary("<", l, r); })
+        .infix("<=", 5, assoc::none, [](std::string l, std::string r) { return binary("<=", l, r); })
+        .infix("!=", 5, assoc::none, [](std::string l, std::string r) { return binary("!=", l, r); })
+        .infix("+", 10, assoc::left, [](std::string l, std::string r) { return binary("+", l, r); })
+        .infix("-", 10, assoc::left, [](std::string l, std::string r) { return binary("-", l, r); })
+        .infix("*", 20, assoc::left, [](std::string l, std::string r) { return binary("*", l, r); })
+        .infix("^", 30, assoc::right, [](std::string l, std::string r) { return binary("^", l, r); })
+        .prefix("-", 25, [](std::string o) { return "(-" + o + ")"; })
+        .postfix("!", 40, [](std::string o) { return "(" + o + "!)"; });
+}
+
+} // anonymous
+
+TEST_CASE("operator_precedence")
+{
+    auto const operand = +x4::digit;
+    auto const expr = x4::operator_precedence(operand, make_table());
+
+    auto const check = [&](std::string_view input, std::string_view expected) {
+        std::string ast;
+        REQUIRE(parse(input, expr, x4::space, ast));
+        CHECK(ast == expected);
+    };
+
+    check("1", "1");
+    check("1 + 2 * 3", "(1+(2*3))");
+    check("1 * 2 + 3", "((1*2)+3)");
+    check("1 - 2 - 3", "((1-2)-3)");
+    check("2 ^ 3 ^ 4", "(2^(3^4))");
+    check("-2 ^ 2", "(-(2^2))");
+    check("-2 * 3", "((-2)*3)");
+    check("3! + 1", "((3!)+1)");
+    check("-3!", "(-(3!))");
+    check("1 < 2 || 3 <= 4", "((1<2)||(3<=4))");
+
+    // the longer of a postfix and an infix token wins
+    check("3 != 1", "(3!=1)");
+    check("3! != 1", "((3!)!=1)");
+    check("3!! + 1", "(((3!)!)+1)");
+
+    {
+        // non-associative: the second `<` is not consumed
+        std::string ast;
+        auto const res = parse("1 < 2 < 3", expr, x4::space, ast);
+        CHECK(res.is_partial_match());
+        CHECK(ast == "(1<2)");
+    }
+    {
+        // an operator without a right operand is left unconsumed
+        std::string ast;
+        auto const res = parse("1 + 2 *", expr, x4::space, ast);
+        CHECK(res.is_partial_match());
+        CHECK(ast == "(1+2)");
+    }
+
+    CHECK(!parse("", expr, x4::space));
+    CHECK(!parse("* 1", expr, x4::space));
+    CHECK(!parse("-", expr, x4::space));
+
+    {
+        // evaluation instead of building an AST
+        using x4::assoc;
+        auto const table = x4::operator_table<int>{}
+            .infix("+", 1, assoc::left, [](int l, int r) { return l + r; })
+            .infix("-", 1, assoc::left, [](int l, int r) { return l - r; })
+            .infix("*", 2, assoc::left, [](int l, int r) { return l * r; })
+            .prefix("-", 3, [](int o) { return -o; });
+        auto const calc = x4::operator_precedence(x4::int_, table);
+
+        int result = 0;
+        REQUIRE(parse("2 * -3 + 10 - 1", calc, x4::space, result));
+        CHECK(result == 3);
+    }
+    {
+        // expectation failures in an operand are propagated
+        auto const strict = x4::operator_precedence('(' > x4::int_ > ')', x4::operator_table<int>{}
+            .infix("+", 1, x4::assoc::left, [](int l, int r) { return l + r; }));
+
+        int result = 0;
+        CHECK(!parse("(1) + (x)", strict, x4::space, result));
+
+        // nothing is consumed on failure
+        std::string_view const input = "(1) + (x)";
+        auto const res = parse(input, strict, x4::space, result);
+        CHECK(!res.ok);
+        CHECK(res.remainder.begin() == input.begin());
+    }
+    {
+        // the nesting is bounded instead of overflowing the stack
+        auto const shallow = x4::operator_precedence(operand, make_table().max_depth(8));
+
+        std::string ast;
+        REQUIRE(parse("----1", shallow, x4::space, ast));
+        CHECK(ast == "(-(-(-(-1))))");
+
+        std::string_view const input = "--------------------1";
+        auto const res = parse(input, shallow, x4::space, ast);
+        CHECK(!res.ok);
+        CHECK(res.remainder.begin() == input.begin());
+        REQUIRE(res.expect_failure);
+        CHECK(res.expect_failure.which() == "(operator_precedence: nesting too deep)");
+
+        std::string const deep = std::string(100000, '-') + "1";
+        CHECK(!parse(deep, expr, x4::space, ast));
+
+        std::string chain = "2";
+        for (int i = 0; i < 100000; ++i) chain += "^2";
+        CHECK(!parse(chain, expr, x4::space, ast));
+    }
+}
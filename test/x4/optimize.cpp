@@ -0,0 +1,234 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/optimize.hpp>
+#include <iris/x4/char/char.hpp>
+#include <iris/x4/char/char_class.hpp>
+#include <iris/x4/string/string.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/operator/sequence.hpp>
+#include <iris/x4/operator/alternative.hpp>
+#include <iris/x4/operator/kleene.hpp>
+#include <iris/x4/directive/omit.hpp>
+#include <iris/x4/directive/lexeme.hpp>
+#include <iris/x4/directive/no_skip.hpp>
+#include <iris/x4/directive/no_case.hpp>
+
+#include <iris/alloy/tuple.hpp>
+#include <iris/rvariant/rvariant.hpp>
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace {
+
+template<class Parser>
+void check_same_results(Parser const& p, std::initializer_list<std::string_view> inputs)
+{
+    auto const opt = x4::optimize(p);
+    for (auto const input : inputs) {
+        auto const expected = parse(input, p);
+        auto const actual = parse(input, opt);
+        CHECK(expected.ok == actual.ok);
+        CHECK(expected.remainder.begin() == actual.remainder.begin());
+    }
+}
+
+template<class Parser>
+void check_same_results_skip(Parser const& p, std::initializer_list<std::string_view> inputs)
+{
+    auto const opt = x4::optimize(p);
+    for (auto const input : inputs) {
+        auto const expected = parse(input, p, x4::space);
+        auto const actual = parse(input, opt, x4::space);
+        CHECK(expected.ok == actual.ok);
+        CHECK(expected.remainder.begin() == actual.remainder.begin());
+    }
+}
+
+} // anonymous
+
+TEST_CASE("optimize literal fusion")
+{
+    using x4::lit;
+    using x4::int_;
+    using encoding = x4::char_encoding::standard;
+
+    {
+        constexpr auto p = lit('a') >> 'b' >> 'c';
+        auto const opt = x4::optimize(p);
+        STATIC_CHECK(std::is_same_v<std::remove_const_t<decltype(opt)>, x4::literal_sequence<encoding, 3>>);
+        CHECK(x4::what(opt) == "\"abc\"");
+
+        check_same_results(p, {"abc", "abcd", "ab", "abd", "", "xabc"});
+        check_same_results_skip(p, {"abc", " a b c", "a bc ", "a b", "ab d"});
+    }
+    {
+        constexpr auto p = int_ >> lit("ab") >> 'c' >> int_;
+        auto const opt = x4::optimize(p);
+        STATIC_CHECK(std::is_same_v<
+            typename x4::parser_traits<std::remove_const_t<decltype(opt)>>::attribute_type,
+            typename x4::parser_traits<std::remove_const_t<decltype(p)>>::attribute_type
+        >);
+
+        alloy::tuple<int, int> attr;
+        REQUIRE(parse("1abc2", opt, attr));
+        CHECK(alloy::get<0>(attr) == 1);
+        CHECK(alloy::get<1>(attr) == 2);
+
+        check_same_results(p, {"1abc2", "1ab2", "1abc", "abc2"});
+        check_same_results_skip(p, {"1 ab c 2", "1 abc2", "1 a b c 2"});
+    }
+}
+
+TEST_CASE("optimize char merging")
+{
+    using x4::lit;
+    using encoding = x4::char_encoding::standard;
+
+    {
+        constexpr auto p = lit('a') | 'b' | 'c';
+        auto const opt = x4::optimize(p);
+        STATIC_CHECK(std::is_same_v<std::remove_const_t<decltype(opt)>, x4::char_set<encoding, x4::unused_type>>);
+
+        check_same_results(p, {"a", "b", "c", "d", "", "ab"});
+        check_same_results_skip(p, {" a", "  c", " d"});
+        CHECK(parse("B", x4::no_case[opt]));
+    }
+    {
+        // chars with an attribute are kept, so that the variant is unchanged
+        constexpr auto p = x4::char_('a') | x4::char_('b');
+        auto const opt = x4::optimize(p);
+        STATIC_CHECK(std::is_same_v<std::remove_const_t<decltype(opt)>, std::remove_const_t<decltype(p)>>);
+    }
+}
+
+TEST_CASE("optimize left factoring")
+{
+    using x4::lit;
+    using x4::int_;
+
+    {
+        constexpr auto p = lit("select") | lit("set") | lit("sex") | lit("se");
+        check_same_results(p, {"select", "set", "sex", "se", "s", "sel", "selectx", "other", ""});
+        check_same_results_skip(p, {" select", " set ", "se lect", " sex"});
+    }
+    {
+        constexpr auto p = lit("select") >> int_ | lit("set") >> int_;
+        auto const opt = x4::optimize(p);
+        STATIC_CHECK(std::is_same_v<
+            typename x4::parser_traits<std::remove_const_t<decltype(opt)>>::attribute_type,
+            iris::rvariant<int, int>
+        >);
+
+        iris::rvariant<int, int> attr;
+        REQUIRE(parse("set42", opt, attr));
+        CHECK(attr.index() == 1);
+        CHECK(iris::get<1>(attr) == 42);
+
+        REQUIRE(parse("select7", opt, attr));
+        CHECK(attr.index() == 0);
+        CHECK(iris::get<0>(attr) == 7);
+
+        CHECK(!parse("sex1", opt, attr));
+        check_same_results(p, {"select1", "set1", "sel1", "se", "select"});
+        check_same_results_skip(p, {" select 1", " set 2", " se t 3"});
+    }
+    {
+        // all branches of an attributed alternative share the prefix
+        constexpr auto p = lit("sel") >> int_ | lit("set") >> int_ | lit("sex") >> int_;
+        auto const opt = x4::optimize(p);
+        STATIC_CHECK(std::is_same_v<
+            typename x4::parser_traits<std::remove_const_t<decltype(opt)>>::attribute_type,
+            iris::rvariant<int, int, int>
+        >);
+        CHECK(x4::what(opt.left) == "\"se\"");
+
+        iris::rvariant<int, int, int> attr;
+        REQUIRE(parse("sex3", opt, attr));
+        CHECK(attr.index() == 2);
+        CHECK(iris::get<2>(attr) == 3);
+
+        check_same_results(p, {"sel1", "set2", "sex3", "sez4", "se", ""});
+        check_same_results_skip(p, {" sel 1", " se t 2", " sex3"});
+    }
+    {
+        // A prefix shared by only some branches of an attributed alternative
+        // is not factored out, to keep the flattened variant
+        constexpr auto p = lit('x') >> int_ | lit("ab") >> int_ | lit("ac") >> int_;
+        auto const opt = x4::optimize(p);
+        STATIC_CHECK(std::is_same_v<
+            typename x4::parser_traits<std::remove_const_t<decltype(opt)>>::attribute_type,
+            iris::rvariant<int, int, int>
+        >);
+        check_same_results(p, {"x1", "ab2", "ac3", "ad4", "a"});
+    }
+}
+
+TEST_CASE("optimize literal storage")
+{
+    using x4::lit;
+    using encoding = x4::char_encoding::standard;
+
+    {
+        // fused literals do not allocate, and are usable in constant expressions
+        constexpr auto opt = x4::optimize(lit("ab") >> 'c' >> lit("de"));
+        STATIC_CHECK(std::is_same_v<std::remove_const_t<decltype(opt)>, x4::literal_sequence<encoding, 3>>);
+        STATIC_CHECK(opt.segments[1].chars() == "c");
+        CHECK(parse("abcde", opt));
+    }
+    {
+        // string literals owning their characters are not fused
+        auto const p = lit(std::string("ab")) >> 'c';
+        auto const opt = x4::optimize(p);
+        STATIC_CHECK(std::is_same_v<std::remove_const_t<decltype(opt)>, std::remove_const_t<decltype(p)>>);
+        check_same_results(p, {"abc", "ab", "abd"});
+    }
+}
+
+TEST_CASE("optimize directives")
+{
+    using x4::lit;
+    using x4::omit;
+    using x4::lexeme;
+    using x4::no_skip;
+    using x4::int_;
+    using x4::alpha;
+
+    {
+        constexpr auto p = omit[omit[int_]];
+        auto const opt = x4::optimize(p);
+        STATIC_CHECK(std::is_same_v<std::remove_const_t<decltype(opt)>, x4::omit_directive<std::remove_const_t<decltype(int_)>>>);
+        check_same_results(p, {"1", "x"});
+    }
+    {
+        constexpr auto p = omit[lit("ab")];
+        auto const opt = x4::optimize(p);
+        STATIC_CHECK(!std::is_same_v<std::remove_const_t<decltype(opt)>, std::remove_const_t<decltype(p)>>);
+        check_same_results(p, {"ab", "a"});
+    }
+    {
+        constexpr auto p = lexeme[lexeme[*alpha]];
+        auto const opt = x4::optimize(p);
+        STATIC_CHECK(std::is_same_v<std::remove_const_t<decltype(opt)>, x4::lexeme_directive<std::remove_const_t<decltype(*alpha)>>>);
+        check_same_results_skip(p, {"  ab c", "abc"});
+    }
+    {
+        constexpr auto p = no_skip[lexeme[*alpha]];
+        auto const opt = x4::optimize(p);
+        STATIC_CHECK(std::is_same_v<std::remove_const_t<decltype(opt)>, x4::no_skip_directive<std::remove_const_t<decltype(*alpha)>>>);
+        check_same_results_skip(p, {"  ab c", "abc"});
+    }
+    {
+        // rewrites apply under unary operators
+        constexpr auto p = *(lit('a') >> 'b');
+        check_same_results(p, {"ababab", "aba", ""});
+    }
+}
@@ -0,0 +1,163 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/core/parse_budget.hpp>
+#include <iris/x4/rule.hpp>
+#include <iris/x4/char/char.hpp>
+#include <iris/x4/directive/seek.hpp>
+#include <iris/x4/directive/seek_any.hpp>
+#include <iris/x4/directive/with.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/operator/kleene.hpp>
+#include <iris/x4/operator/list.hpp>
+#include <iris/x4/operator/operator_precedence.hpp>
+#include <iris/x4/operator/sequence.hpp>
+#include <iris/x4/symbols.hpp>
+
+#include <chrono>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+x4::rule<struct nested_r> const nested("nested");
+
+auto const nested_def = '[' >> *nested >> ']';
+
+IRIS_X4_DEFINE(nested)
+
+} // anonymous
+
+TEST_CASE("parse_budget")
+{
+    using x4::parse_budget;
+    using x4::budget_exhaustion;
+
+    // Compiled out when no budget is bound
+    STATIC_CHECK(std::is_empty_v<x4::detail::scoped_budget_rule<
+        x4::parse_context_for<std::string_view>, std::string_view::const_iterator
+    >>);
+
+    std::string const as(100, 'a');
+
+    {
+        parse_budget budget;
+        REQUIRE(parse(as, x4::with<x4::contexts::budget>(budget)[*x4::char_]));
+        CHECK(!budget.exhausted());
+        CHECK(budget.steps() == 101);
+    }
+    {
+        // The 11th iteration is not started
+        parse_budget budget;
+        budget.set_max_steps(10);
+        auto const res = parse(as, x4::with<x4::contexts::budget>(budget)[*x4::char_]);
+        CHECK(!res.ok);
+        CHECK(budget.reason() == budget_exhaustion::steps);
+        REQUIRE(res.expect_failure.has_value());
+        CHECK(res.expect_failure.which() == "(parse budget exhausted: steps)");
+        CHECK(res.expect_failure.where() == as.cbegin() + 10);
+    }
+    {
+        parse_budget budget;
+        budget.set_max_steps(10);
+        auto const res = parse(as, x4::with<x4::contexts::budget>(budget)[x4::seek['b']]);
+        CHECK(!res.ok);
+        CHECK(budget.reason() == budget_exhaustion::steps);
+
+        // Only the usage is forgotten
+        budget.reset();
+        CHECK(!budget.exhausted());
+        CHECK(budget.steps() == 0);
+        CHECK(parse("aab", x4::with<x4::contexts::budget>(budget)[x4::seek['b']]));
+        CHECK(!parse(as, x4::with<x4::contexts::budget>(budget)[x4::seek['b']]));
+    }
+    {
+        // `seek_any` takes a step per input position scanned
+        x4::shared_symbols<> const tags = {"b"};
+        parse_budget budget;
+        budget.set_max_steps(10);
+        CHECK(parse("aab", x4::with<x4::contexts::budget>(budget)[x4::seek_any(tags)]));
+
+        budget.reset();
+        CHECK(!parse(as, x4::with<x4::contexts::budget>(budget)[x4::seek_any(tags)]));
+        CHECK(budget.reason() == budget_exhaustion::steps);
+    }
+    {
+        // `operator_precedence` takes a step per operator
+        auto const sum = x4::operator_precedence(
+            x4::int_,
+            x4::operator_table<int>{}.infix("+", 1, x4::assoc::left, [](int l, int r) { return l + r; })
+        );
+        parse_budget budget;
+        budget.set_max_steps(3);
+        int i = 0;
+        CHECK(parse("1+2", x4::with<x4::contexts::budget>(budget)[sum], i));
+        CHECK(i == 3);
+
+        budget.reset();
+        CHECK(!parse("1+2+3+4+5", x4::with<x4::contexts::budget>(budget)[sum]));
+        CHECK(budget.reason() == budget_exhaustion::steps);
+    }
+    {
+        parse_budget budget;
+        budget.set_max_depth(3);
+        CHECK(parse("[[][[]]]", x4::with<x4::contexts::budget>(budget)[nested]));
+        CHECK(budget.depth() == 0);
+
+        auto const res = parse("[[[[]]]]", x4::with<x4::contexts::budget>(budget)[nested]);
+        CHECK(!res.ok);
+        CHECK(budget.reason() == budget_exhaustion::depth);
+        CHECK(budget.depth() == 0);
+        REQUIRE(res.expect_failure.has_value());
+        CHECK(res.expect_failure.which() == "(parse budget exhausted: depth)");
+    }
+    {
+        parse_budget budget;
+        budget.set_max_attribute_bytes(3 * sizeof(int));
+        {
+            std::vector<int> ints;
+            CHECK(parse("1,2,3", x4::with<x4::contexts::budget>(budget)[x4::int_ % ','], ints));
+            CHECK(budget.attribute_bytes() == 3 * sizeof(int));
+        }
+        budget.reset();
+        {
+            std::vector<int> ints;
+            auto const res = parse("1,2,3,4,5", x4::with<x4::contexts::budget>(budget)[x4::int_ % ','], ints);
+            CHECK(!res.ok);
+            CHECK(budget.reason() == budget_exhaustion::attribute_memory);
+            CHECK(ints.size() == 4);
+            REQUIRE(res.expect_failure.has_value());
+            CHECK(res.expect_failure.which() == "(parse budget exhausted: attribute memory)");
+        }
+    }
+    {
+        parse_budget budget;
+        budget.set_check_interval(1);
+        budget.set_deadline(parse_budget::clock::now() - std::chrono::seconds(1));
+        CHECK(!parse(as, x4::with<x4::contexts::budget>(budget)[*x4::char_]));
+        CHECK(budget.reason() == budget_exhaustion::deadline);
+        CHECK(budget.steps() == 1);
+    }
+    {
+        std::stop_source source;
+        parse_budget budget;
+        budget.set_check_interval(4);
+        budget.set_stop_token(source.get_token());
+        CHECK(parse("aaa", x4::with<x4::contexts::budget>(budget)[*x4::char_]));
+
+        budget.reset();
+        source.request_stop();
+        CHECK(!parse(as, x4::with<x4::contexts::budget>(budget)[*x4::char_]));
+        CHECK(budget.reason() == budget_exhaustion::cancelled);
+        CHECK(budget.steps() == 4);
+    }
+}
@@ -0,0 +1,168 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/parse_two_phase.hpp>
+#include <iris/x4/rule.hpp>
+#include <iris/x4/char/char.hpp>
+#include <iris/x4/char/char_class.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/operator/alternative.hpp>
+#include <iris/x4/operator/sequence.hpp>
+#include <iris/x4/operator/kleene.hpp>
+#include <iris/x4/operator/plus.hpp>
+#include <iris/x4/operator/list.hpp>
+
+#include <iris/rvariant.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+struct counted_attribute
+{
+    static inline int constructed = 0;
+
+    counted_attribute() { ++constructed; }
+};
+
+} // anonymous
+
+TEST_CASE("decision_log")
+{
+    x4::decision_log log;
+    CHECK(!log.replaying());
+
+    for (int i = 0; i < 10; ++i) {
+        (void)log.push(static_cast<x4::decision>(i % 3));
+    }
+    REQUIRE(log.size() == 10);
+    for (int i = 0; i < 10; ++i) {
+        CHECK(log[i] == static_cast<x4::decision>(i % 3));
+    }
+
+    log.set(5, x4::decision::left);
+    CHECK(log[4] == x4::decision::right);
+    CHECK(log[5] == x4::decision::left);
+    CHECK(log[6] == x4::decision::left);
+
+    log.truncate(5);
+    CHECK(log.size() == 5);
+    CHECK(log.push(x4::decision::none) == 5);
+
+    log.replay();
+    CHECK(log.replaying());
+    CHECK(log.next() == x4::decision::left);
+    CHECK(log.next() == x4::decision::right);
+    CHECK(log.next() == x4::decision::none);
+    CHECK(log.next() == x4::decision::left);
+    CHECK(log.next() == x4::decision::right);
+    CHECK(log.next() == x4::decision::none);
+    CHECK(log.next() == x4::decision::none); // past the end
+
+    log.clear();
+    CHECK(log.size() == 0);
+    CHECK(!log.replaying());
+}
+
+TEST_CASE("parse_two_phase")
+{
+    using x4::rule;
+    using x4::int_;
+    using x4::alpha;
+    using x4::lit;
+
+    {
+        // the left branch fails late, after building a string
+        auto const p = +alpha >> ';' | +alpha >> '.';
+        for (std::string_view const input : {"abc;", "abc.", "abc", "abc!", ""}) {
+            std::string expected, actual;
+            auto const expected_res = x4::parse(input, p, expected);
+            auto const actual_res = x4::parse_two_phase(input, p, actual);
+            CHECK(expected_res.ok == actual_res.ok);
+            CHECK(expected_res.remainder.begin() == actual_res.remainder.begin());
+            CHECK(expected == actual);
+        }
+    }
+    {
+        auto const p = int_ >> '!' | alpha;
+        iris::rvariant<int, char> attr;
+
+        REQUIRE(x4::parse_two_phase("42!", p, attr));
+        CHECK(attr.index() == 0);
+        CHECK(iris::get<0>(attr) == 42);
+
+        REQUIRE(x4::parse_two_phase("z", p, attr));
+        CHECK(attr.index() == 1);
+        CHECK(iris::get<1>(attr) == 'z');
+
+        CHECK(!x4::parse_two_phase("42?", p, attr));
+        CHECK(attr.index() == 1); // untouched
+    }
+    {
+        // alternatives under repetition, into a container of variants
+        auto const p = *(int_ >> ';' | alpha);
+        std::vector<iris::rvariant<int, char>> attr;
+        REQUIRE(x4::parse_two_phase("1;a2;bc", p, attr));
+        REQUIRE(attr.size() == 5);
+        CHECK(iris::get<0>(attr[0]) == 1);
+        CHECK(iris::get<1>(attr[1]) == 'a');
+        CHECK(iris::get<0>(attr[2]) == 2);
+        CHECK(iris::get<1>(attr[3]) == 'b');
+        CHECK(iris::get<1>(attr[4]) == 'c');
+    }
+    {
+        // nested alternatives, with a skipper
+        auto const p = (int_ >> "px" | int_ >> "em" | int_ >> '%') % ',';
+        std::vector<int> expected, actual;
+        auto const expected_res = x4::parse(" 1 px, 2em ,3 %, 4", p, x4::space, expected);
+        auto const actual_res = x4::parse_two_phase(" 1 px, 2em ,3 %, 4", p, x4::space, actual);
+        CHECK(expected_res.ok == actual_res.ok);
+        CHECK(expected_res.remainder.begin() == actual_res.remainder.begin());
+        CHECK(actual == std::vector<int>{1, 2, 3});
+        CHECK(expected == actual);
+    }
+    {
+        // the first run constructs no rule attribute
+        auto const counted = rule<struct counted_id, counted_attribute>("counted") = lit("ab");
+
+        counted_attribute::constructed = 0;
+        CHECK(!x4::parse_two_phase("ac", counted, x4::unused));
+        CHECK(counted_attribute::constructed == 0);
+
+        REQUIRE(x4::parse_two_phase("ab", counted, x4::unused));
+        CHECK(counted_attribute::constructed == 1);
+    }
+    {
+        // actions are invoked by the second run only, along the recorded path
+        int calls = 0;
+        auto const count = [&] { ++calls; };
+        auto const ident = rule<struct ident_id, std::string>("ident") = (+alpha)[count] >> ';' | +alpha >> '.';
+
+        REQUIRE(x4::parse_two_phase("abc.", ident, x4::unused));
+        CHECK(calls == 0);
+
+        REQUIRE(x4::parse_two_phase("abc;", ident, x4::unused));
+        CHECK(calls == 1);
+
+        CHECK(!x4::parse_two_phase("abc!", ident, x4::unused));
+        CHECK(calls == 1);
+    }
+    {
+        // expectation failures are reported as by `parse`
+        auto const p = lit('a') > 'b' | lit('c');
+        auto const expected_res = x4::parse("ac", p, x4::unused);
+        auto const actual_res = x4::parse_two_phase("ac", p, x4::unused);
+        CHECK(!actual_res.ok);
+        REQUIRE(actual_res.expect_failure);
+        CHECK(actual_res.expect_failure.where() == expected_res.expect_failure.where());
+        CHECK(actual_res.expect_failure.which() == expected_res.expect_failure.which());
+    }
+}
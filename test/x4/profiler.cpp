@@ -0,0 +1,99 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/debug/profiler.hpp>
+#include <iris/x4/rule.hpp>
+#include <iris/x4/directive/with.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/operator/alternative.hpp>
+#include <iris/x4/operator/kleene.hpp>
+#include <iris/x4/operator/sequence.hpp>
+
+#include <string_view>
+#include <type_traits>
+
+TEST_CASE("profiler")
+{
+    using x4::rule;
+    using x4::int_;
+
+    // Compiled out when no profiler is bound
+    STATIC_CHECK(std::is_empty_v<x4::detail::scoped_rule_profiler<
+        struct any_id, x4::parse_context_for<std::string_view>, std::string_view::const_iterator
+    >>);
+
+    auto const num = rule<struct num_id, int>("num") = int_;
+    auto const pair_a = rule<struct pair_a_id>("pair_a") = num >> ',' >> num >> 'a';
+    auto const pair_b = rule<struct pair_b_id>("pair_b") = num >> ',' >> num >> 'b';
+    auto const item = rule<struct item_id>("item") = pair_a | pair_b;
+
+    x4::profiler prof;
+    REQUIRE(parse("12,34b;5,6a;", x4::with<x4::contexts::profiler>(prof)[*(item >> ';')]));
+
+    {
+        auto const* p = prof.find("num");
+        REQUIRE(p != nullptr);
+        CHECK(p->calls == 8);
+        CHECK(p->successes == 6);
+        CHECK(p->failures == 2);
+        CHECK(p->consumed_bytes == 10);
+        CHECK(p->backtracked_bytes == 0);
+    }
+    {
+        // "12,34" is matched by two `num`s, then `'a'` fails
+        auto const* p = prof.find("pair_a");
+        REQUIRE(p != nullptr);
+        CHECK(p->calls == 3);
+        CHECK(p->successes == 1);
+        CHECK(p->failures == 2);
+        CHECK(p->consumed_bytes == 4);
+        CHECK(p->backtracked_bytes == 4);
+    }
+    {
+        auto const* p = prof.find("pair_b");
+        REQUIRE(p != nullptr);
+        CHECK(p->calls == 2);
+        CHECK(p->successes == 1);
+        CHECK(p->failures == 1);
+        CHECK(p->consumed_bytes == 6);
+    }
+    {
+        auto const* p = prof.find("item");
+        REQUIRE(p != nullptr);
+        CHECK(p->calls == 3);
+        CHECK(p->successes == 2);
+        CHECK(p->failures == 1);
+        CHECK(p->consumed_bytes == 10);
+        CHECK(p->backtracked_bytes == 0);
+    }
+
+    REQUIRE(prof.entries().size() == 4);
+    CHECK(prof.entries()[0].rule_name == "num");
+    CHECK(prof.find("unknown") == nullptr);
+
+    {
+        x4::profiler total;
+        total.merge(prof);
+        total.merge(prof);
+        REQUIRE(total.find("item") != nullptr);
+        CHECK(total.find("item")->calls == 6);
+        CHECK(total.entries().size() == 4);
+    }
+
+    prof.clear();
+    CHECK(prof.entries().empty());
+
+    {
+        // Distinct rules sharing a name are aggregated
+        auto const num2 = rule<struct num2_id, int>("num") = int_;
+        REQUIRE(parse("1,2", x4::with<x4::contexts::profiler>(prof)[num >> ',' >> num2]));
+        REQUIRE(prof.entries().size() == 1);
+        CHECK(prof.entries()[0].profile.calls == 2);
+    }
+}
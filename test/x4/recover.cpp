@@ -0,0 +1,120 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/parse_recovering.hpp>
+#include <iris/x4/directive/recover.hpp>
+#include <iris/x4/directive/with.hpp>
+#include <iris/x4/auxiliary/eps.hpp>
+#include <iris/x4/char/char.hpp>
+#include <iris/x4/char/char_class.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/operator/kleene.hpp>
+#include <iris/x4/operator/optional.hpp>
+#include <iris/x4/operator/sequence.hpp>
+
+#include <string_view>
+#include <vector>
+
+TEST_CASE("recover")
+{
+    using x4::int_;
+    using x4::lit;
+    using x4::recover;
+    using x4::parse_recovering;
+
+    auto const statement = lit('s') > int_ > ';';
+    auto const program = *recover(';')[statement];
+
+    {
+        std::string_view const input = "s1;s2;";
+        auto const res = parse_recovering(input, program, unused);
+        CHECK(res.completed());
+        CHECK(!res.has_failures());
+    }
+    {
+        // Each broken statement is skipped up to and including the next ';'
+        std::string_view const input = "s1;s2 3;s;s4;";
+        auto const res = parse_recovering(input, program, unused);
+        CHECK(res.completed());
+        CHECK(!res.expect_failure.has_value());
+        CHECK(res.has_failures());
+        REQUIRE(res.recovered_failures.size() == 2);
+        CHECK(res.recovered_failures[0].where() - input.begin() == 5);
+        CHECK(res.recovered_failures[1].where() - input.begin() == 9);
+        CHECK(res.all_failures().size() == 2);
+    }
+    {
+        // Without a synchronization point, the rest of the input is skipped
+        std::string_view const input = "s1;s2 3";
+        auto const res = parse_recovering(input, program, unused);
+        CHECK(res.completed());
+        REQUIRE(res.recovered_failures.size() == 1);
+        CHECK(res.recovered_failures[0].where() - input.begin() == 5);
+    }
+    {
+        // Attributes of recovered statements are kept as far as they were parsed
+        std::string_view const input = "s1;s2 3;s4;";
+        std::vector<int> ints;
+        auto const res = parse_recovering(input, program, ints);
+        CHECK(res.completed());
+        CHECK(res.recovered_failures.size() == 1);
+        REQUIRE(ints.size() == 3);
+        CHECK(ints.front() == 1);
+        CHECK(ints.back() == 4);
+    }
+    {
+        // With a skipper
+        std::string_view const input = "s 1 ; s 2 3 ; s 4 ;";
+        auto const res = parse_recovering(input, program, x4::standard::space, unused);
+        CHECK(res.completed());
+        CHECK(res.recovered_failures.size() == 1);
+    }
+    {
+        // Failures other than expectation failures are not recovered from
+        std::string_view const input = "x;";
+        auto const res = parse_recovering(input, recover(';')[statement], unused);
+        CHECK(!res.ok);
+        CHECK(!res.has_failures());
+    }
+    {
+        // An unrecovered failure is reported as usual
+        std::string_view const input = "s1;s2 3;";
+        auto const res = parse_recovering(input, *recover(';')[statement] > lit('!'), unused);
+        CHECK(!res.ok);
+        CHECK(res.recovered_failures.size() == 1);
+        CHECK(res.expect_failure.has_value());
+        CHECK(res.all_failures().size() == 2);
+    }
+    {
+        // An expectation failure at the end of input is not recovered from,
+        // as `*recover(...)` would loop forever
+        std::string_view const input = "a";
+        auto const res = parse_recovering(input, *recover(';')[x4::eps > 'x'], unused);
+        CHECK(!res.ok);
+        REQUIRE(res.recovered_failures.size() == 1);
+        CHECK(res.recovered_failures[0].where() == input.begin());
+        REQUIRE(res.expect_failure.has_value());
+        CHECK(res.expect_failure.where() == input.end());
+    }
+    {
+        // Nor one which would skip nothing
+        std::string_view const input = "";
+        auto const res = parse_recovering(input, recover(';')[-lit('k') > ';'], unused);
+        CHECK(!res.ok);
+        CHECK(res.recovered_failures.empty());
+        CHECK(res.expect_failure.has_value());
+    }
+    {
+        // Any container can be bound explicitly
+        std::string_view const input = "s1;s;";
+        std::vector<x4::expectation_failure<std::string_view::const_iterator>> failures;
+        CHECK(parse(input, x4::with<x4::contexts::recovered_failures>(failures)[program]));
+        CHECK(failures.size() == 1);
+    }
+}
@@ -0,0 +1,94 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/directive/ref_attr.hpp>
+#include <iris/x4/directive/no_case.hpp>
+#include <iris/x4/symbols.hpp>
+#include <iris/x4/char/char_class.hpp>
+#include <iris/x4/operator/sequence.hpp>
+#include <iris/x4/operator/kleene.hpp>
+#include <iris/x4/operator/optional.hpp>
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("ref_attr")
+{
+    using x4::unique_symbols;
+    using x4::shared_symbols;
+    using x4::ref_attr;
+
+    // Parsers hold their subjects by value; with `shared_symbols`, every copy
+    // refers to the same table, so the pointers outlive temporary parsers.
+    shared_symbols<std::string> sym = {
+        {"a", "alpha"}, {"b", "bravo"}, {"c", "charlie"}
+    };
+
+    {
+        unique_symbols<std::string> const table = {{"a", "alpha"}, {"b", "bravo"}};
+        auto const p = ref_attr[table];
+        static_assert(std::is_same_v<x4::parser_traits<std::remove_const_t<decltype(p)>>::attribute_type, std::string const*>);
+
+        std::string const* ptr = nullptr;
+        REQUIRE(parse("b", p, ptr));
+        REQUIRE(ptr != nullptr);
+        CHECK(*ptr == "bravo");
+
+        // the pointer refers to the table held by the parser, not a copy
+        std::string const* ptr2 = nullptr;
+        REQUIRE(parse("b", p, ptr2));
+        CHECK(ptr == ptr2);
+
+        ptr = nullptr;
+        CHECK(!parse("x", p, ptr));
+        CHECK(ptr == nullptr);
+
+        CHECK(parse("a", p));
+    }
+
+    {
+        std::reference_wrapper<std::string const> ref = std::cref(*sym.find("a"));
+        REQUIRE(parse("c", ref_attr[sym], ref));
+        CHECK(ref.get() == "charlie");
+    }
+
+    {
+        std::vector<std::string const*> ptrs;
+        REQUIRE(parse("abc", *ref_attr[sym], ptrs));
+        REQUIRE(ptrs.size() == 3);
+        CHECK(*ptrs[0] == "alpha");
+        CHECK(*ptrs[1] == "bravo");
+        CHECK(*ptrs[2] == "charlie");
+    }
+
+    {
+        std::optional<std::string const*> ptr;
+        REQUIRE(parse("A", x4::no_case[-ref_attr[sym]], ptr));
+        REQUIRE(ptr.has_value());
+        CHECK(**ptr == "alpha");
+    }
+
+    {
+        // skipping is applied before the lookup
+        shared_symbols<int> nums = {{"one", 1}, {"two", 2}};
+        int const* ptr = nullptr;
+        REQUIRE(parse("  two", ref_attr[nums], x4::space, ptr));
+        CHECK(*ptr == 2);
+    }
+
+    {
+        // the default, copying attribute is unchanged
+        std::string s;
+        REQUIRE(parse("a", sym, s));
+        CHECK(s == "alpha");
+    }
+}
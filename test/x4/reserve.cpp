@@ -0,0 +1,104 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/char/char.hpp>
+#include <iris/x4/directive/repeat.hpp>
+#include <iris/x4/directive/reserve.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/operator/kleene.hpp>
+#include <iris/x4/operator/list.hpp>
+#include <iris/x4/operator/sequence.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("reserve")
+{
+    using x4::reserve;
+    using x4::reserve_by;
+    using x4::reserve_by_input;
+    using x4::repeat;
+    using x4::int_;
+    using x4::standard::char_;
+
+    IRIS_X4_ASSERT_CONSTEXPR_CTORS(reserve(10)['x']);
+    IRIS_X4_ASSERT_CONSTEXPR_CTORS(reserve_by_input(2)['x']);
+    IRIS_X4_ASSERT_CONSTEXPR_CTORS(reserve_by_input(2, 16)['x']);
+
+    {
+        std::vector<int> v;
+        REQUIRE(parse("1,2,3", reserve(100)[int_ % ','], v));
+        CHECK(v == std::vector<int>{1, 2, 3});
+        CHECK(v.capacity() >= 100);
+    }
+    {
+        // Does not shrink the capacity nor drop the existing elements
+        std::vector<int> v{0};
+        v.reserve(200);
+        REQUIRE(parse("1,2", reserve(100)[int_ % ','], v));
+        CHECK(v.capacity() >= 200);
+    }
+    {
+        std::vector<int> v;
+        auto const by_commas = [](auto first, auto const& last) {
+            std::size_t n = 1;
+            for (; first != last; ++first) {
+                if (*first == ',') ++n;
+            }
+            return n;
+        };
+        REQUIRE(parse("1,2,3,4,5", reserve_by(by_commas)[int_ % ','], v));
+        CHECK(v == std::vector<int>{1, 2, 3, 4, 5});
+        CHECK(v.capacity() >= 5);
+    }
+    {
+        std::vector<int> v;
+        std::string_view const input = "1,2,3,4,5,6,7,8";
+        REQUIRE(parse(input, reserve_by_input(2)[int_ % ','], v));
+        CHECK(v.size() == 8);
+        CHECK(v.capacity() >= input.size() / 2);
+    }
+    {
+        // The cap bounds the reservation, e.g. for nested containers
+        std::string_view const input = "1,2,3,4,5,6,7,8";
+        CHECK(x4::detail::reserve_input_length{2}(input.begin(), input.end()) == input.size() / 2);
+        CHECK(x4::detail::reserve_input_length{2, 3}(input.begin(), input.end()) == 3);
+
+        std::vector<std::vector<int>> vv;
+        REQUIRE(parse("[1,2][3]", *('[' >> reserve_by_input(1, 2)[int_ % ','] >> ']'), vv));
+        REQUIRE(vv.size() == 2);
+        CHECK(vv[1] == std::vector<int>{3});
+        CHECK(vv[1].capacity() <= 2);
+    }
+    {
+        std::string s;
+        REQUIRE(parse("abc", reserve(64)[*char_], s));
+        CHECK(s == "abc");
+        CHECK(s.capacity() >= 64);
+    }
+    {
+        // Reservation does not affect the match
+        CHECK(parse("1,2,3", reserve(100)[int_ % ',']));
+        CHECK(!parse("x", reserve(100)[int_ % ',']));
+    }
+    {
+        std::string s;
+        REQUIRE(parse("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", repeat(40)[char_], s));
+        CHECK(s.size() == 40);
+        CHECK(s.capacity() >= 40);
+    }
+    {
+        std::vector<char> v;
+        REQUIRE(parse("abcdefghijklmnopqrstuvwxyz", repeat(26, x4::repeat_inf)[char_], v));
+        CHECK(v.size() == 26);
+        CHECK(v.capacity() >= 26);
+    }
+}
@@ -25,7 +25,9 @@
 #include <iris/alloy/adapted/std_pair.hpp>
 #include <iris/alloy/adapt.hpp>
 
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <vector>
 #include <cstring>
 
@@ -103,6 +105,24 @@ IRIS_X4_INSTANTIATE(decltype(grammar), iterator_type, x4::parse_context_for<iter
 
 } // check_recursive_tuple
 
+namespace check_container_in_place {
+
+x4::rule<class ints_r, std::vector<int>> const ints;
+auto const ints_def = x4::int_ % ',' >> ';';
+IRIS_X4_DEFINE(ints)
+
+// Records where the rule attribute lives
+inline std::vector<int> const* tracked_ints_attr = nullptr;
+
+x4::rule<class tracked_ints_r, std::vector<int>> const tracked_ints;
+auto const tracked_ints_def = (x4::int_ % ',')[([](auto&& ctx) {
+    tracked_ints_attr = &x4::_rule_var(ctx);
+    x4::_rule_var(ctx) = x4::_attr(ctx);
+})];
+IRIS_X4_DEFINE(tracked_ints)
+
+} // check_container_in_place
+
 TEST_CASE("rule3")
 {
     using namespace x4::standard;
@@ -168,4 +188,65 @@ TEST_CASE("rule3")
         REQUIRE(parse("[4,2]", grammar, v));
         CHECK((node_t{node_array{{4}, {2}}} == v));
     }
+
+    // a rule appending to the caller's container
+    {
+        using namespace check_container_in_place;
+        std::vector<int> v;
+        REQUIRE(parse("1,2;3;4,5,6;", +ints, v));
+        CHECK(v == std::vector<int>{1, 2, 3, 4, 5, 6});
+
+        // rolled back when the rule fails, whether or not the container was empty
+        v.clear();
+        CHECK(!parse("1,2", +ints, v));
+        CHECK(v.empty());
+
+        auto const res = parse("1,2;3,4", *ints, v);
+        CHECK(res.is_partial_match());
+        CHECK(v == std::vector<int>{1, 2});
+    }
+
+    // a rule definition which only appends is parsed straight into a non-empty
+    // container, which is truncated back on failure
+    {
+        auto const pair = x4::rule<struct pair_r, std::vector<int>>("pair") = x4::int_ >> ',' >> x4::int_ >> ';';
+        STATIC_CHECK(x4::detail::appends_only<std::remove_cvref_t<decltype(pair.rhs)>>::value);
+        STATIC_CHECK(!x4::detail::appends_only<std::remove_cvref_t<decltype(x4::int_ | x4::int_ >> ',')>>::value);
+
+        std::vector<int> v;
+        auto const res = parse("1,2;3,4;5,", *pair, v);
+        CHECK(res.is_partial_match());
+        CHECK(v == std::vector<int>{1, 2, 3, 4});
+    }
+
+    // ... unless an action might see the preceding elements through `_rule_var`
+    {
+        auto const f = [](auto&&) {};
+        STATIC_CHECK(!x4::detail::appends_only<std::remove_cvref_t<decltype(*(x4::int_[f]))>>::value);
+        STATIC_CHECK(!x4::detail::appends_only<std::remove_cvref_t<decltype(x4::int_[f] % ',')>>::value);
+    }
+
+    // a rule is parsed straight into a disengaged `std::optional`
+    {
+        using namespace check_container_in_place;
+        STATIC_CHECK(x4::traits::TransformableInPlace<std::vector<int>, std::optional<std::vector<int>>>);
+
+        std::optional<std::vector<int>> v;
+        REQUIRE(parse("1,2", tracked_ints, v));
+        REQUIRE(v.has_value());
+        CHECK(*v == std::vector<int>{1, 2});
+        CHECK(tracked_ints_attr == &*v);
+
+        // disengaged again when the rule fails
+        v.reset();
+        CHECK(!parse("x", tracked_ints, v));
+        CHECK(!v.has_value());
+
+        // an engaged one is kept when the rule fails
+        v = std::vector<int>{7};
+        CHECK(!parse("x", tracked_ints, v));
+        CHECK(*v == std::vector<int>{7});
+        REQUIRE(parse("3", tracked_ints, v));
+        CHECK(*v == std::vector<int>{3});
+    }
 }
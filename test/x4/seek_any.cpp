@@ -0,0 +1,125 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/directive/seek_any.hpp>
+#include <iris/x4/directive/seek.hpp>
+#include <iris/x4/string/aho_corasick.hpp>
+#include <iris/x4/symbols.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/operator/sequence.hpp>
+#include <iris/x4/operator/plus.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("aho_corasick")
+{
+    x4::aho_corasick<char, int> ac;
+    ac.add("he", 1);
+    ac.add("she", 2);
+    ac.add("his", 3);
+    ac.add("hers", 4);
+    ac.add("abcd", 5);
+    ac.add("bc", 6);
+    ac.compile();
+
+    auto const find = [&](std::string_view s) {
+        return ac.find(s.begin(), s.end());
+    };
+
+    {
+        auto const m = find("ushers");
+        REQUIRE(m);
+        // "she" starts leftmost
+        CHECK(m->offset == 1);
+        CHECK(m->length == 3);
+        CHECK(*m->value == 2);
+    }
+    {
+        auto const m = find("xxhersxx");
+        REQUIRE(m);
+        // longest at the leftmost start
+        CHECK(m->offset == 2);
+        CHECK(m->length == 4);
+        CHECK(*m->value == 4);
+    }
+    {
+        // an earlier start reported later wins
+        auto const m = find("abcd");
+        REQUIRE(m);
+        CHECK(m->offset == 0);
+        CHECK(*m->value == 5);
+    }
+    {
+        auto const m = find("abce");
+        REQUIRE(m);
+        CHECK(m->offset == 1);
+        CHECK(*m->value == 6);
+    }
+
+    CHECK(!find(""));
+    CHECK(!find("xyz"));
+    CHECK(!find("h"));
+
+    {
+        x4::aho_corasick<char, int> empty;
+        empty.compile();
+        std::string_view const s = "abc";
+        CHECK(!empty.find(s.begin(), s.end()));
+    }
+}
+
+TEST_CASE("seek_any")
+{
+    using x4::seek_any;
+    using x4::seek;
+    using x4::int_;
+
+    x4::shared_symbols<int> markers = {
+        {"ERROR", 1}, {"WARN", 2}, {"WARNING", 3}, {"INFO", 4}
+    };
+
+    {
+        int val = 0;
+        REQUIRE(parse("2026-01-01 WARNING disk", seek_any(markers), val).is_partial_match());
+        CHECK(val == 3);
+    }
+
+    {
+        // same results as `seek[symbols]`
+        std::string_view const inputs[] = {
+            "..INFO..ERROR", "WARN", "xxWARNINGxx", "ERRO", "", "INFOWARN"
+        };
+        auto const fast = seek_any(markers);
+        for (auto const input : inputs) {
+            int slow_val = 0, fast_val = 0;
+            auto const slow_res = parse(input, seek[markers], slow_val);
+            auto const fast_res = parse(input, fast, fast_val);
+            CHECK(slow_res.ok == fast_res.ok);
+            CHECK(slow_res.remainder.begin() == fast_res.remainder.begin());
+            CHECK(slow_val == fast_val);
+        }
+    }
+
+    {
+        std::vector<int> vals;
+        REQUIRE(parse("INFO a WARN b ERROR c", +seek_any(markers), vals).is_partial_match());
+        CHECK(vals == std::vector<int>{4, 2, 1});
+    }
+
+    {
+        x4::shared_symbols<> const tags = {"ERROR", "FATAL"};
+        int code = 0;
+        REQUIRE(parse("... ERROR 42", seek_any(tags) >> ' ' >> int_, code));
+        CHECK(code == 42);
+    }
+
+    CHECK(x4::what(seek_any(markers)) == "seek_any[symbols]");
+}
@@ -0,0 +1,133 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/char/char.hpp>
+#include <iris/x4/char/char_class.hpp>
+#include <iris/x4/directive/repeat.hpp>
+#include <iris/x4/directive/sink.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/operator/alternative.hpp>
+#include <iris/x4/operator/kleene.hpp>
+#include <iris/x4/operator/list.hpp>
+#include <iris/x4/operator/plus.hpp>
+#include <iris/x4/operator/sequence.hpp>
+#include <iris/x4/validate.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+TEST_CASE("sink")
+{
+    using x4::sink;
+    using x4::repeat;
+    using x4::int_;
+    using x4::standard::char_;
+    using x4::standard::alpha;
+
+    {
+        std::vector<int> out;
+        auto const collect = [&out](int& i) { out.push_back(i); };
+
+        REQUIRE(parse("1,2,3", sink(collect)[int_ % ',']));
+        CHECK(out == std::vector<int>{1, 2, 3});
+    }
+    {
+        int sum = 0;
+        auto const add = [&sum](int& i) { sum += i; };
+
+        REQUIRE(parse("1;2;3;4;", sink(add)[+(int_ >> ';')]));
+        CHECK(sum == 10);
+    }
+    {
+        std::string out;
+        auto const collect = [&out](char& c) { out.push_back(c); };
+
+        REQUIRE(parse("abcd", sink(collect)[repeat(4)[char_]]));
+        CHECK(out == "abcd");
+    }
+    {
+        // Each element is parsed into the same buffer
+        std::vector<std::string> words;
+        std::vector<char const*> buffers;
+        auto const collect = [&](std::string& w) {
+            buffers.push_back(w.data());
+            words.push_back(w); // copy, keeping the buffer
+        };
+
+        REQUIRE(parse("alpha,beta,gamma", sink(collect)[+alpha % ',']));
+        CHECK(words == std::vector<std::string>{"alpha", "beta", "gamma"});
+        REQUIRE(buffers.size() == 3);
+        CHECK(buffers[0] == buffers[1]);
+        CHECK(buffers[1] == buffers[2]);
+    }
+    {
+        // The callback may take the element
+        std::vector<std::string> words;
+        auto const take = [&](std::string& w) { words.push_back(std::move(w)); };
+
+        REQUIRE(parse("ab,cd", sink(take)[+alpha % ',']));
+        CHECK(words == std::vector<std::string>{"ab", "cd"});
+    }
+    {
+        // Only successfully parsed elements are delivered
+        std::vector<int> out;
+        auto const collect = [&out](int& i) { out.push_back(i); };
+
+        REQUIRE(parse("1,2,x", sink(collect)[int_ % ','] >> ",x"));
+        CHECK(out == std::vector<int>{1, 2});
+    }
+    {
+        std::vector<int> out;
+        auto const collect = [&out](int& i) { out.push_back(i); };
+
+        CHECK(!parse("x", sink(collect)[+int_]));
+        CHECK(out.empty());
+    }
+    {
+        // Only the successful branch of an alternative is delivered
+        std::vector<int> out;
+        auto const collect = [&out](int& i) { out.push_back(i); };
+
+        REQUIRE(parse("1,2.", sink(collect)[(int_ % ',' >> ';') | (int_ % ',' >> '.')]));
+        CHECK(out == std::vector<int>{1, 2});
+    }
+    {
+        // The callback may be mutable; each parse uses its own copy
+        int count = 0;
+        auto counter = [n = 0, &count](int&) mutable { count = ++n; };
+
+        REQUIRE(parse("1,2,3", sink(counter)[int_ % ',']));
+        CHECK(count == 3);
+        REQUIRE(parse("4,5", sink(counter)[int_ % ',']));
+        CHECK(count == 2);
+
+        REQUIRE(parse("1,2,3", sink(std::ref(counter))[int_ % ',']));
+        REQUIRE(parse("4,5", sink(std::ref(counter))[int_ % ',']));
+        CHECK(count == 5);
+    }
+    {
+        // Nothing is delivered while validating
+        std::vector<int> out;
+        auto const collect = [&out](int& i) { out.push_back(i); };
+
+        CHECK(x4::validate("1,2,3", sink(collect)[int_ % ',']));
+        CHECK(out.empty());
+    }
+    {
+        // Exposes no attribute
+        std::vector<char> out;
+        auto const collect = [&out](char& c) { out.push_back(c); };
+
+        int i = 0;
+        REQUIRE(parse("abc42", sink(collect)[*alpha] >> int_, i));
+        CHECK(i == 42);
+        CHECK(out == std::vector<char>{'a', 'b', 'c'});
+    }
+}
@@ -16,6 +16,11 @@
 #include <iris/x4/char_encoding/standard_wide.hpp>
 
 #include <string>
+#include <string_view>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <cctype>
 #include <iostream>
 
@@ -342,3 +347,91 @@ TEST_CASE("tst")
     using x4::tst;
     tests<tst<char, int>, tst<wchar_t, int>>();
 }
+
+TEST_CASE("tst_prefix_range")
+{
+    using Lookup = x4::tst<char, int>;
+    using entry = std::pair<std::string, int>;
+
+    Lookup lookup;
+    add(lookup, "pineapple", 1);
+    add(lookup, "orange", 2);
+    add(lookup, "banana", 3);
+    add(lookup, "applepie", 4);
+    add(lookup, "apple", 5);
+    add(lookup, "applet", 6);
+
+    auto const collect = [](auto&& range) {
+        std::vector<entry> res;
+        for (auto const& [key, value] : range) {
+            res.emplace_back(std::string(key), value);
+        }
+        return res;
+    };
+
+    // all entries, in lexicographic order
+    CHECK(collect(lookup.prefix_range()) == std::vector<entry>{
+        {"apple", 5}, {"applepie", 4}, {"applet", 6}, {"banana", 3}, {"orange", 2}, {"pineapple", 1}
+    });
+
+    // the prefix itself is an entry
+    CHECK(collect(lookup.prefix_range("apple")) == std::vector<entry>{
+        {"apple", 5}, {"applepie", 4}, {"applet", 6}
+    });
+
+    CHECK(collect(lookup.prefix_range("app")) == std::vector<entry>{
+        {"apple", 5}, {"applepie", 4}, {"applet", 6}
+    });
+    CHECK(collect(lookup.prefix_range("applep")) == std::vector<entry>{{"applepie", 4}});
+    CHECK(collect(lookup.prefix_range("or")) == std::vector<entry>{{"orange", 2}});
+    CHECK(collect(lookup.prefix_range("x")).empty());
+    CHECK(collect(lookup.prefix_range("orangey")).empty());
+    CHECK(collect(Lookup{}.prefix_range()).empty());
+    CHECK(collect(Lookup{}.prefix_range("a")).empty());
+
+    // bounded traversal
+    CHECK(collect(lookup.prefix_range("a") | std::views::take(2)) == std::vector<entry>{
+        {"apple", 5}, {"applepie", 4}
+    });
+
+    // reuse a cursor across queries
+    {
+        x4::tst_cursor<char, int> cursor;
+        lookup.prefix_range("b", cursor);
+        REQUIRE(cursor.valid());
+        CHECK(cursor.key() == "banana");
+        CHECK(cursor.value() == 3);
+        CHECK(!cursor.next());
+        CHECK(!cursor);
+
+        lookup.prefix_range("p", cursor);
+        REQUIRE(cursor);
+        CHECK(cursor.key() == "pineapple");
+        cursor.value() = 10;
+        CHECK(!cursor.next());
+
+        int const* val = nullptr;
+        std::string_view const s = "pineapple";
+        auto first = s.begin();
+        val = lookup.find(first, s.end(), ncomp);
+        REQUIRE(val);
+        CHECK(*val == 10);
+    }
+
+    // a const table only gives const access to the values
+    {
+        Lookup const& const_lookup = lookup;
+        STATIC_CHECK(std::is_same_v<decltype(const_lookup.prefix_range()), x4::tst_cursor<char, int const>>);
+        STATIC_CHECK(std::is_same_v<decltype(lookup.prefix_range()), x4::tst_cursor<char, int>>);
+        STATIC_CHECK(std::is_same_v<decltype(const_lookup.prefix_range().value()), int const&>);
+        STATIC_CHECK(std::is_same_v<std::ranges::range_reference_t<x4::tst_cursor<char, int const>>, std::pair<std::string_view, int const&>>);
+
+        CHECK(collect(const_lookup.prefix_range("or")) == std::vector<entry>{{"orange", 2}});
+
+        x4::tst_cursor<char, int const> cursor;
+        const_lookup.prefix_range("b", cursor);
+        REQUIRE(cursor);
+        CHECK(cursor.key() == "banana");
+        CHECK(cursor.value() == 3);
+    }
+}
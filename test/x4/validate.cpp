@@ -0,0 +1,100 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/validate.hpp>
+#include <iris/x4/rule.hpp>
+#include <iris/x4/char/char.hpp>
+#include <iris/x4/char/char_class.hpp>
+#include <iris/x4/numeric/int.hpp>
+#include <iris/x4/operator/sequence.hpp>
+#include <iris/x4/operator/plus.hpp>
+#include <iris/x4/operator/list.hpp>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct counted_attribute
+{
+    static inline int constructed = 0;
+
+    counted_attribute() { ++constructed; }
+};
+
+} // anonymous
+
+TEST_CASE("validate")
+{
+    using x4::rule;
+    using x4::int_;
+    using x4::alpha;
+    using x4::lit;
+    using x4::_attr;
+
+    STATIC_CHECK(x4::is_validating_v<x4::validate_context_for<std::string_view>>);
+    STATIC_CHECK(!x4::is_validating_v<x4::parse_context_for<std::string_view>>);
+
+    {
+        int calls = 0;
+        auto const count = [&] { ++calls; };
+
+        auto const ident = rule<struct ident_id, std::string>("ident") = +alpha;
+        auto const list = rule<struct list_id, std::vector<std::string>>("list") = ident[count] % ',';
+
+        CHECK(x4::validate("ab,cd,e", list));
+        CHECK(!x4::validate("ab,", list));
+        CHECK(!x4::validate("", list));
+        CHECK(x4::validate(" ab , cd ", list, x4::space));
+        CHECK(calls == 0); // actions are skipped
+
+        auto const res = x4::validate("ab;", list);
+        CHECK(res.ok);
+        CHECK(res.is_partial_match());
+        CHECK(std::string_view(res.remainder.begin(), res.remainder.end()) == ";");
+
+        REQUIRE(parse("ab,cd", list));
+        CHECK(calls == 2);
+    }
+    {
+        auto const byte = int_[x4::required([](auto&& ctx) { return _attr(ctx) < 256; })];
+        CHECK(x4::validate("255", byte));
+        CHECK(!x4::validate("256", byte));
+
+        int value = 0;
+        REQUIRE(parse("42", byte, value));
+        CHECK(value == 42);
+
+        auto const unchecked = int_[([](auto&& ctx) { return _attr(ctx) < 256; })];
+        CHECK(x4::validate("256", unchecked));
+        CHECK(!parse("256", unchecked));
+    }
+    {
+        // rules construct no attribute
+        auto const counted = rule<struct counted_id, counted_attribute>("counted") = lit("ab");
+        counted_attribute::constructed = 0;
+        CHECK(x4::validate("ab", counted));
+        CHECK(!x4::validate("ac", counted));
+        CHECK(counted_attribute::constructed == 0);
+    }
+    {
+        // a skipped action does not affect the exception specification
+        auto const p = lit('a')[([] {})];
+        using It = std::string_view::const_iterator;
+        using Context = x4::validate_context_for<std::string_view>;
+        STATIC_CHECK(noexcept(p.parse(std::declval<It&>(), std::declval<It const&>(), std::declval<Context const&>(), x4::unused)));
+    }
+    {
+        auto const res = x4::validate("ac", lit('a') > 'b');
+        CHECK(!res.ok);
+        CHECK(res.expect_failure);
+    }
+}
@@ -0,0 +1,88 @@
+/*=============================================================================
+    Copyright (c) 2026 The Iris Project Contributors
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "iris_x4_test.hpp"
+
+#include <iris/x4/rule.hpp>
+#include <iris/x4/auxiliary/eoi.hpp>
+#include <iris/x4/char/char.hpp>
+#include <iris/x4/directive/without.hpp>
+#include <iris/x4/operator/sequence.hpp>
+#include <iris/x4/string/string.hpp>
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace {
+
+struct some_context {};
+
+x4::rule<struct b_r> const b_rule("b_rule");
+
+auto const b_rule_def = x4::lit('b');
+
+IRIS_X4_DEFINE(b_rule)
+
+} // anonymous
+
+TEST_CASE("what")
+{
+    using x4::eoi;
+    using x4::lit;
+    using x4::without;
+
+    // Descriptions of enclosing parsers are built at compile time
+    STATIC_CHECK(x4::X4StaticInfo<x4::eoi_parser>);
+    STATIC_CHECK(x4::X4StaticInfo<x4::without_directive<x4::eoi_parser, some_context>>);
+    STATIC_CHECK(x4::get_info<x4::without_directive<x4::eoi_parser, some_context>>::value == "without<...>[eoi]");
+    CHECK(x4::what(without<some_context>[eoi]) == "without<...>[eoi]");
+
+    // Falls back to a runtime description
+    STATIC_CHECK(!x4::X4StaticInfo<std::remove_cvref_t<decltype(b_rule)>>);
+    CHECK(x4::what(without<some_context>[b_rule]) == "without<...>[b_rule]");
+
+    {
+        // Static descriptions are referred to, not copied
+        auto const res = parse("ab", lit('a') > eoi);
+        REQUIRE(res.expect_failure.has_value());
+        CHECK(res.expect_failure.which() == "eoi");
+        CHECK(res.expect_failure.which().data() == x4::get_info<x4::eoi_parser>::value.data());
+
+        auto copy = res.expect_failure;
+        CHECK(copy.which().data() == x4::get_info<x4::eoi_parser>::value.data());
+
+        copy.clear();
+        CHECK(!copy.has_value());
+    }
+    {
+        // Rule names are referred to, as by the rule itself
+        auto const res = parse("ac", lit('a') > b_rule);
+        REQUIRE(res.expect_failure.has_value());
+        CHECK(res.expect_failure.which() == "b_rule");
+        CHECK(res.expect_failure.which().data() == b_rule.name.data());
+    }
+    {
+        // Literal strings are copied in quotes, viewing their characters or not
+        auto const res = parse("ab", lit('a') > lit("cd"));
+        REQUIRE(res.expect_failure.has_value());
+        CHECK(res.expect_failure.which() == "\"cd\"");
+        CHECK(res.expect_failure.which() == x4::what(lit("cd")));
+
+        std::string const long_literal = "a literal longer than any small string buffer";
+        auto const res2 = parse("ab", lit('a') > lit(long_literal));
+        REQUIRE(res2.expect_failure.has_value());
+        CHECK(res2.expect_failure.which() == x4::what(lit(long_literal)));
+    }
+    {
+        // An empty static description is still a failure
+        x4::expectation_failure<char const*> failure;
+        failure.emplace_static(nullptr, "");
+        CHECK(failure.has_value());
+        CHECK(failure.which().empty());
+    }
+}